@@ -0,0 +1,46 @@
+#ifndef CPP2_SRC_ALL_BENCHMARKS_S21_BENCH_H_
+#define CPP2_SRC_ALL_BENCHMARKS_S21_BENCH_H_
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/*
+Minimal helpers shared by the benchmarks. Every benchmark is a separate
+program: `make bench` builds each file with optimisations and runs it. The
+first command line argument (if any) overrides the default number of elements,
+so the big runs from the requests can be reproduced by hand, e.g.
+./bench_out 100000000
+ */
+namespace s21_bench {
+
+// number of elements: argv[1] or the default
+inline std::size_t ElementCount(int argc, char **argv, std::size_t def) {
+  if (argc > 1) {
+    return std::strtoull(argv[1], nullptr, 10);
+  }
+  return def;
+}
+
+// runs func once and returns the elapsed wall time in milliseconds
+template <typename Func>
+double Measure(Func &&func) {
+  auto start = std::chrono::steady_clock::now();
+  func();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+inline void Report(const char *name, std::size_t n, double ms) {
+  std::printf("%-48s n=%-11zu %10.2f ms\n", name, n, ms);
+}
+
+// keeps the optimiser from throwing away results that are otherwise unused
+template <typename T>
+inline void DoNotOptimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+}  // namespace s21_bench
+
+#endif  // CPP2_SRC_ALL_BENCHMARKS_S21_BENCH_H_
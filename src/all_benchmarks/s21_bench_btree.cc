@@ -0,0 +1,75 @@
+#include <cstdlib>
+#include <new>
+#include <random>
+
+#include "../s21_btree_set.h"
+#include "../s21_set.h"
+#include "s21_bench.h"
+
+// Small integer keys: the red-black s21::set against the B+ tree btree_set.
+// Memory is the number of bytes requested from operator new while the keys
+// are inserted (malloc's own per-block overhead comes on top, and hits the
+// one-node-per-key tree much harder). Lookups are random hits.
+
+namespace {
+
+std::size_t allocated_bytes = 0;
+
+template <typename Set>
+void InsertAll(Set &set, const int *keys, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) set.insert(keys[i]);
+}
+
+template <typename Set>
+std::size_t LookupAll(Set &set, const int *keys, std::size_t n) {
+  std::size_t found = 0;
+  for (std::size_t i = 0; i < n; ++i) found += set.contains(keys[i]);
+  return found;
+}
+
+template <typename Set>
+void Run(const char *name, const int *keys, const int *queries,
+         std::size_t n) {
+  Set set;
+  std::size_t before = allocated_bytes;
+  double ms = s21_bench::Measure([&] { InsertAll(set, keys, n); });
+  std::size_t bytes = allocated_bytes - before;
+  std::printf("%s: %.1f bytes per key\n", name,
+              static_cast<double>(bytes) / static_cast<double>(set.size()));
+  s21_bench::Report("  insert random keys", n, ms);
+
+  std::size_t found = 0;
+  ms = s21_bench::Measure([&] { found = LookupAll(set, queries, n); });
+  s21_bench::Report("  contains, random hits", n, ms);
+  s21_bench::DoNotOptimize(found);
+}
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+  allocated_bytes += size;
+  void *ptr = std::malloc(size);
+  if (ptr == nullptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 2000000);
+
+  std::mt19937 gen(1);
+  int *keys = new int[n];
+  int *queries = new int[n];
+  for (std::size_t i = 0; i < n; ++i) keys[i] = static_cast<int>(gen());
+  for (std::size_t i = 0; i < n; ++i) queries[i] = keys[gen() % n];
+
+  Run<s21::set<int>>("s21::set<int>", keys, queries, n);
+  Run<s21::btree_set<int>>("s21::btree_set<int>", keys, queries, n);
+
+  delete[] keys;
+  delete[] queries;
+  return 0;
+}
@@ -0,0 +1,73 @@
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_map.h"
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+// Write-heavy session counters: every thread does n operations on random
+// keys out of 1 << 16, 80% read-modify-write update(), 10% insert_or_assign,
+// 10% erase. The same work runs with 1 to 64 hash shards (1 shard is one
+// big lock) and tree shards, for 1 to N threads. The time is for all
+// threads together.
+
+namespace {
+
+const unsigned kKeys = 1 << 16;
+
+template <typename Map>
+void Run(const char *name, unsigned threads, std::size_t n) {
+  Map map;
+  double ms = s21_bench::Measure([&] {
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+      workers.emplace_back([&map, n, t] {
+        std::mt19937 gen(t);
+        for (std::size_t i = 0; i < n; ++i) {
+          unsigned op = gen() % 10;
+          int key = static_cast<int>(gen() % kKeys);
+          if (op < 8) {
+            map.update(key, 0, [](long long &hits) { ++hits; });
+          } else if (op == 8) {
+            map.insert_or_assign(key, 1);
+          } else {
+            map.erase(key);
+          }
+        }
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s, %u threads", name, threads);
+  s21_bench::Report(label, n * threads, ms);
+  s21_bench::DoNotOptimize(map.size());
+}
+
+template <std::size_t Shards>
+using HashShards = s21::concurrent_map<int, long long, Shards>;
+
+template <std::size_t Shards>
+using TreeShards =
+    s21::concurrent_map<int, long long, Shards, s21::map<int, long long>>;
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 500000);
+  unsigned max_threads = std::thread::hardware_concurrency();
+  if (max_threads < 4) max_threads = 4;
+
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+    Run<HashShards<1>>("hash, 1 shard", threads, n);
+    Run<HashShards<4>>("hash, 4 shards", threads, n);
+    Run<HashShards<16>>("hash, 16 shards", threads, n);
+    Run<HashShards<64>>("hash, 64 shards", threads, n);
+    Run<TreeShards<1>>("s21::map, 1 shard", threads, n);
+    Run<TreeShards<16>>("s21::map, 16 shards", threads, n);
+  }
+  return 0;
+}
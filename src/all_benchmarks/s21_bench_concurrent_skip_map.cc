@@ -0,0 +1,118 @@
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_skip_map.h"
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+// Ordered map shared by all threads: the lazy concurrent_skip_map against
+// s21::map behind one std::mutex. Every thread does n operations on random
+// keys out of 1 << 18: 50% find, 20% insert, 20% erase, 10% short scans of
+// 16 keys from lower_bound. The time is for all threads together.
+
+namespace {
+
+const unsigned kKeys = 1 << 18;
+const int kScan = 16;
+
+struct LockedMap {
+  bool find(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return map.find(key) != map.end();
+  }
+  void insert(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    map.insert(key, value);
+  }
+  void erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    map.erase(key);
+  }
+  long long scan(int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    long long sum = 0;
+    auto pos = map.lower_bound(key);
+    for (int i = 0; i < kScan && pos != map.end(); ++i, ++pos) {
+      sum += (*pos).second;
+    }
+    return sum;
+  }
+
+  std::mutex mutex;
+  s21::map<int, int> map;
+};
+
+struct SkipMap {
+  bool find(int key) { return map.contains(key); }
+  void insert(int key, int value) { map.insert(key, value); }
+  void erase(int key) { map.erase(key); }
+  long long scan(int key) {
+    long long sum = 0;
+    auto pos = map.lower_bound(key);
+    for (int i = 0; i < kScan && pos != map.end(); ++i, ++pos) {
+      sum += pos->second;
+    }
+    return sum;
+  }
+
+  s21::concurrent_skip_map<int, int> map;
+};
+
+template <typename Map>
+void Run(const char *name, unsigned threads, std::size_t n) {
+  Map map;
+  std::mt19937 fill(1);
+  for (unsigned i = 0; i < kKeys / 2; ++i) {
+    map.insert(static_cast<int>(fill() % kKeys), static_cast<int>(i));
+  }
+
+  long long checksum = 0;
+  std::mutex checksum_mutex;
+  double ms = s21_bench::Measure([&] {
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+      workers.emplace_back([&, t] {
+        std::mt19937 gen(t + 2);
+        long long sum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+          unsigned op = gen() % 10;
+          int key = static_cast<int>(gen() % kKeys);
+          if (op < 5) {
+            sum += map.find(key);
+          } else if (op < 7) {
+            map.insert(key, static_cast<int>(i));
+          } else if (op < 9) {
+            map.erase(key);
+          } else {
+            sum += map.scan(key);
+          }
+        }
+        std::lock_guard<std::mutex> lock(checksum_mutex);
+        checksum += sum;
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s, %u threads", name, threads);
+  s21_bench::Report(label, n * threads, ms);
+  s21_bench::DoNotOptimize(checksum);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 500000);
+  unsigned max_threads = std::thread::hardware_concurrency();
+  if (max_threads < 4) max_threads = 4;
+
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+    Run<SkipMap>("concurrent_skip_map", threads, n);
+    Run<LockedMap>("s21::map + mutex", threads, n);
+  }
+  return 0;
+}
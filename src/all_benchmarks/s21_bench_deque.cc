@@ -0,0 +1,87 @@
+#include "../s21_deque.h"
+#include "../s21_list.h"
+#include "../s21_queue.h"
+#include "../s21_stack.h"
+#include "../s21_vector.h"
+#include "s21_bench.h"
+
+// Stack and Queue over the three possible backings. s21::Vector has no
+// pop_front, so it only takes part in the stack runs.
+
+namespace {
+
+template <typename Container>
+void StackWorkload(std::size_t n) {
+  s21::Stack<int, Container> stack;
+  long long sum = 0;
+  for (std::size_t round = 0; round < 4; ++round) {
+    for (std::size_t i = 0; i < n; ++i) {
+      stack.push(static_cast<int>(i));
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      sum += stack.top();
+      stack.pop();
+    }
+  }
+  s21_bench::DoNotOptimize(sum);
+}
+
+template <typename Container>
+void QueueWorkload(std::size_t n) {
+  s21::Queue<int, Container> que;
+  long long sum = 0;
+  // sliding window: the queue stays about 1000 elements long
+  for (std::size_t i = 0; i < n; ++i) {
+    que.push(static_cast<int>(i));
+    if (que.size() > 1000) {
+      sum += que.front();
+      que.pop();
+    }
+  }
+  s21_bench::DoNotOptimize(sum);
+}
+
+template <typename Container>
+void BothEnds(std::size_t n) {
+  Container container;
+  long long sum = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    container.push_back(static_cast<int>(i));
+    container.push_front(static_cast<int>(i));
+  }
+  for (int value : container) {
+    sum += value;
+  }
+  while (!container.empty()) {
+    container.pop_front();
+    container.pop_back();
+  }
+  s21_bench::DoNotOptimize(sum);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 2000000);
+
+  s21_bench::Report("Stack<List> 4x push+pop", n, s21_bench::Measure([&] {
+                      StackWorkload<s21::List<int>>(n);
+                    }));
+  s21_bench::Report("Stack<Vector> 4x push+pop", n, s21_bench::Measure([&] {
+                      StackWorkload<s21::Vector<int>>(n);
+                    }));
+  s21_bench::Report("Stack<Deque> 4x push+pop", n, s21_bench::Measure([&] {
+                      StackWorkload<s21::Deque<int>>(n);
+                    }));
+  s21_bench::Report("Queue<List> sliding window", n, s21_bench::Measure([&] {
+                      QueueWorkload<s21::List<int>>(n);
+                    }));
+  s21_bench::Report("Queue<Deque> sliding window", n, s21_bench::Measure([&] {
+                      QueueWorkload<s21::Deque<int>>(n);
+                    }));
+  s21_bench::Report("List push/pop both ends + scan", n,
+                    s21_bench::Measure([&] { BothEnds<s21::List<int>>(n); }));
+  s21_bench::Report("Deque push/pop both ends + scan", n,
+                    s21_bench::Measure([&] { BothEnds<s21::Deque<int>>(n); }));
+  return 0;
+}
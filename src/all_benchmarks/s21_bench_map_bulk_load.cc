@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+// Rebuilding a map from a snapshot: n inserts of already sorted pairs, the
+// O(n) assign_sorted on the same pairs, and the range constructor on the
+// pairs shuffled (sort, then the same bottom-up build).
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 2000000);
+
+  std::vector<std::pair<long long, int>> sorted(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    sorted[i] = std::make_pair(static_cast<long long>(i) * 3,
+                               static_cast<int>(i));
+  }
+  std::vector<std::pair<long long, int>> shuffled(sorted);
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(1));
+
+  {
+    s21::map<long long, int> orders;
+    s21_bench::Report("insert one by one, sorted input", n,
+                      s21_bench::Measure([&] {
+                        for (auto &item : sorted) {
+                          orders.insert(item.first, item.second);
+                        }
+                      }));
+    s21_bench::DoNotOptimize(orders.size());
+  }
+  {
+    s21::map<long long, int> orders;
+    s21_bench::Report("assign_sorted, sorted input", n,
+                      s21_bench::Measure([&] {
+                        orders.assign_sorted(sorted.begin(), sorted.end());
+                      }));
+    s21_bench::DoNotOptimize(orders.size());
+  }
+  {
+    double ms = s21_bench::Measure([&] {
+      s21::map<long long, int> orders(shuffled.begin(), shuffled.end());
+      s21_bench::DoNotOptimize(orders.size());
+    });
+    s21_bench::Report("range constructor, shuffled input (incl. free)", n,
+                      ms);
+  }
+  return 0;
+}
@@ -0,0 +1,54 @@
+#include <random>
+
+#include "../s21_map.h"
+#include "../s21_set.h"
+#include "s21_bench.h"
+
+// Deep copy of large red-black containers: the copy constructor walks the
+// source once in pre-order without recursion and links every new node to its
+// parent in the copy. The copy is then iterated to show it is self-contained
+// and that walking it costs about the same as walking the source.
+// The request's 10M-node run: ./bench_out 10000000
+
+namespace {
+
+template <typename Container>
+void Run(const char *name, Container &source, std::size_t n) {
+  double ms = 0;
+  {
+    Container *copy = nullptr;
+    ms = s21_bench::Measure([&] { copy = new Container(source); });
+    s21_bench::Report(name, n, ms);
+
+    std::size_t count = 0;
+    ms = s21_bench::Measure([&] {
+      for (auto iter = copy->begin(); iter != copy->end(); ++iter) ++count;
+    });
+    s21_bench::Report("  iterate the copy", count, ms);
+    ms = s21_bench::Measure([&] { delete copy; });
+    s21_bench::Report("  destroy the copy", n, ms);
+  }
+  std::size_t count = 0;
+  ms = s21_bench::Measure([&] {
+    for (auto iter = source.begin(); iter != source.end(); ++iter) ++count;
+  });
+  s21_bench::Report("  iterate the source", count, ms);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 2000000);
+
+  std::mt19937_64 gen(1);
+  s21::map<long long, long long> map;
+  s21::set<long long> set;
+  for (std::size_t i = 0; i < n; ++i) {
+    long long key = static_cast<long long>(gen());
+    map.insert(key, key);
+    set.insert(key);
+  }
+  Run("copy s21::map<long long, long long>", map, map.size());
+  Run("copy s21::set<long long>", set, set.size());
+  return 0;
+}
@@ -0,0 +1,47 @@
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+// Appending an ascending feed: every key is greater than the previous one.
+// insert() descends from the root each time; emplace_hint() with end() or
+// with the iterator returned by the previous call checks the neighbours of
+// the hint and links the node without a descent. The request's 100M run:
+// ./bench_out 100000000
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 5000000);
+
+  {
+    s21::map<long long, int> feed;
+    double ms = s21_bench::Measure([&] {
+      for (std::size_t i = 0; i < n; ++i) {
+        feed.insert(static_cast<long long>(i), static_cast<int>(i));
+      }
+    });
+    s21_bench::Report("insert, no hint", n, ms);
+    s21_bench::DoNotOptimize(feed.size());
+  }
+  {
+    s21::map<long long, int> feed;
+    double ms = s21_bench::Measure([&] {
+      for (std::size_t i = 0; i < n; ++i) {
+        feed.emplace_hint(feed.end(), static_cast<long long>(i),
+                          static_cast<int>(i));
+      }
+    });
+    s21_bench::Report("emplace_hint(end())", n, ms);
+    s21_bench::DoNotOptimize(feed.size());
+  }
+  {
+    s21::map<long long, int> feed;
+    double ms = s21_bench::Measure([&] {
+      auto hint = feed.end();
+      for (std::size_t i = 0; i < n; ++i) {
+        hint = feed.emplace_hint(hint, static_cast<long long>(i),
+                                 static_cast<int>(i));
+      }
+    });
+    s21_bench::Report("emplace_hint(previous result)", n, ms);
+    s21_bench::DoNotOptimize(feed.size());
+  }
+  return 0;
+}
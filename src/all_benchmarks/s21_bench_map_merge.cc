@@ -0,0 +1,60 @@
+#include <random>
+
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+// Combining two shards of random order ids. A union the old way copies one
+// shard and inserts every element of the other; set_union is one linear walk
+// plus a bottom-up build of the result. merge moves the nodes of one shard
+// into the other in place (no allocation, no copies).
+
+namespace {
+
+using Shard = s21::map<long long, int>;
+
+void Fill(Shard &shard, std::mt19937_64 &gen, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) {
+    shard.insert(static_cast<long long>(gen() % (4 * n)), static_cast<int>(i));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 1000000);
+  std::mt19937_64 gen(1);
+  Shard a, b;
+  Fill(a, gen, n);
+  Fill(b, gen, n);
+
+  {
+    double ms = s21_bench::Measure([&] {
+      Shard target(a);
+      for (auto &item : b) target.insert(item);
+      s21_bench::DoNotOptimize(target.size());
+    });
+    s21_bench::Report("copy a, insert every element of b", n, ms);
+  }
+  {
+    Shard target(a), source(b);
+    s21_bench::Report("merge (moves nodes)", n, s21_bench::Measure([&] {
+                        target.merge(source);
+                      }));
+    s21_bench::DoNotOptimize(target.size());
+  }
+  {
+    Shard result;
+    s21_bench::Report("set_union", n, s21_bench::Measure([&] {
+                        result = set_union(a, b);
+                      }));
+    s21_bench::DoNotOptimize(result.size());
+  }
+  {
+    Shard result;
+    s21_bench::Report("set_intersection", n, s21_bench::Measure([&] {
+                        result = set_intersection(a, b);
+                      }));
+    s21_bench::DoNotOptimize(result.size());
+  }
+  return 0;
+}
@@ -0,0 +1,73 @@
+#include <random>
+
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+// "All orders between t1 and t2": timestamps are inserted in ascending order,
+// then narrow windows (about 100 keys) are scanned. range() finds the window
+// with one descent; the old way walked from begin() up to t1.
+
+namespace {
+
+constexpr int kWindow = 100;
+
+long long ScanWithRange(s21::map<long long, int> &orders,
+                        const long long *starts, std::size_t queries) {
+  long long sum = 0;
+  for (std::size_t q = 0; q < queries; ++q) {
+    for (auto &item : orders.range(starts[q], starts[q] + kWindow)) {
+      sum += item.first;
+    }
+  }
+  return sum;
+}
+
+long long ScanFromBegin(s21::map<long long, int> &orders,
+                        const long long *starts, std::size_t queries) {
+  long long sum = 0;
+  for (std::size_t q = 0; q < queries; ++q) {
+    auto iter = orders.begin();
+    while (iter != orders.end() && iter->first < starts[q]) {
+      ++iter;
+    }
+    for (; iter != orders.end() && iter->first < starts[q] + kWindow; ++iter) {
+      sum += iter->first;
+    }
+  }
+  return sum;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 10000000);
+  const std::size_t kQueries = 100000;
+  const std::size_t kSlowQueries = 20;
+
+  s21::map<long long, int> orders;
+  s21_bench::Report("map insert ascending timestamps", n,
+                    s21_bench::Measure([&] {
+                      for (std::size_t i = 0; i < n; ++i) {
+                        orders.insert(static_cast<long long>(i), 0);
+                      }
+                    }));
+
+  std::mt19937_64 gen(1);
+  long long *starts = new long long[kQueries];
+  for (std::size_t q = 0; q < kQueries; ++q) {
+    starts[q] = static_cast<long long>(gen() % n);
+  }
+
+  long long sum = 0;
+  double ms = s21_bench::Measure(
+      [&] { sum += ScanWithRange(orders, starts, kQueries); });
+  s21_bench::Report("range(t1, t2), 100k queries of 100 keys", n, ms);
+
+  ms = s21_bench::Measure(
+      [&] { sum += ScanFromBegin(orders, starts, kSlowQueries); });
+  s21_bench::Report("walk from begin(), 20 queries of 100 keys", n, ms);
+
+  s21_bench::DoNotOptimize(sum);
+  delete[] starts;
+  return 0;
+}
@@ -0,0 +1,52 @@
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+// Retention sweep: drop the oldest half of a time-ordered map. Erasing key by
+// key unlinks and rebalances n/2 times; erase(first, last) cuts the range out
+// with two splits and a join and frees its subtree in one pass.
+
+namespace {
+
+void Fill(s21::map<long long, int> &orders, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) {
+    orders.insert(static_cast<long long>(i), static_cast<int>(i));
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 2000000);
+  long long cut = static_cast<long long>(n / 2);
+
+  {
+    s21::map<long long, int> orders;
+    Fill(orders, n);
+    double ms = s21_bench::Measure([&] {
+      for (long long key = 0; key < cut; ++key) orders.erase(key);
+    });
+    s21_bench::Report("erase(key) for every old key", n / 2, ms);
+    s21_bench::DoNotOptimize(orders.size());
+  }
+  {
+    s21::map<long long, int> orders;
+    Fill(orders, n);
+    double ms = s21_bench::Measure([&] {
+      while (orders.begin() != orders.end() && orders.begin()->first < cut) {
+        orders.erase(orders.begin());
+      }
+    });
+    s21_bench::Report("erase(begin()) while older than cut", n / 2, ms);
+    s21_bench::DoNotOptimize(orders.size());
+  }
+  {
+    s21::map<long long, int> orders;
+    Fill(orders, n);
+    double ms = s21_bench::Measure([&] {
+      orders.erase(orders.begin(), orders.lower_bound(cut));
+    });
+    s21_bench::Report("erase(begin(), lower_bound(cut))", n / 2, ms);
+    s21_bench::DoNotOptimize(orders.size());
+  }
+  return 0;
+}
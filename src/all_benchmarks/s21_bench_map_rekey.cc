@@ -0,0 +1,62 @@
+#include <random>
+#include <string>
+
+#include "../s21_map.h"
+#include "s21_bench.h"
+
+// Moving orders between price levels: every step takes a resting order off
+// one key and puts it back under another. erase + insert frees the node,
+// allocates a new one and copies the value; extract + insert(node) relinks
+// the same node.
+
+namespace {
+
+const std::string kPayload(48, 'x');  // value that does not fit in SSO
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 1000000);
+  const long long kOrders = 100000;
+
+  std::mt19937_64 gen(1);
+  long long *moves = new long long[n];
+  for (std::size_t i = 0; i < n; ++i) {
+    moves[i] = static_cast<long long>(gen() % kOrders);
+  }
+
+  {
+    s21::map<long long, std::string> book;
+    for (long long key = 0; key < kOrders; ++key) book.insert(key, kPayload);
+    double ms = s21_bench::Measure([&] {
+      for (std::size_t i = 0; i < n; ++i) {
+        auto pos = book.lower_bound(moves[i]);
+        if (pos == book.end()) pos = book.begin();
+        std::string value = pos->second;
+        long long key = pos->first + kOrders;
+        book.erase(pos);
+        book.insert(key, value);
+      }
+    });
+    s21_bench::Report("re-key by erase + insert", n, ms);
+    s21_bench::DoNotOptimize(book.size());
+  }
+  {
+    s21::map<long long, std::string> book;
+    for (long long key = 0; key < kOrders; ++key) book.insert(key, kPayload);
+    double ms = s21_bench::Measure([&] {
+      for (std::size_t i = 0; i < n; ++i) {
+        auto pos = book.lower_bound(moves[i]);
+        if (pos == book.end()) pos = book.begin();
+        auto node = book.extract(pos);
+        node.key() += kOrders;
+        book.insert(std::move(node));
+      }
+    });
+    s21_bench::Report("re-key by extract + insert(node)", n, ms);
+    s21_bench::DoNotOptimize(book.size());
+  }
+
+  delete[] moves;
+  return 0;
+}
@@ -0,0 +1,61 @@
+#include <random>
+
+#include "../s21_map.h"
+#include "../s21_persistent_map.h"
+#include "s21_bench.h"
+
+// Snapshot of a large state map for a reader: s21::map has to deep-copy
+// every node, persistent_map shares the tree in O(1). Then the writer keeps
+// going: the first writes after a snapshot copy their O(log n) paths, writes
+// with no live snapshot change nodes in place.
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 2000000);
+  const std::size_t kWrites = 200000;
+
+  std::mt19937_64 gen(1);
+  s21::map<long long, long long> state;
+  s21::persistent_map<long long, long long> persistent;
+  for (std::size_t i = 0; i < n; ++i) {
+    long long key = static_cast<long long>(i);
+    state.insert(key, key);
+    persistent.insert(key, key);
+  }
+
+  {
+    double ms = s21_bench::Measure([&] {
+      s21::map<long long, long long> copy(state);
+      s21_bench::DoNotOptimize(copy.size());
+    });
+    s21_bench::Report("s21::map copy (incl. free)", n, ms);
+  }
+
+  s21::persistent_map<long long, long long> snapshot;
+  s21_bench::Report("persistent_map snapshot", n, s21_bench::Measure([&] {
+                      snapshot = persistent.snapshot();
+                    }));
+
+  s21_bench::Report("  writes while the snapshot is alive", kWrites,
+                    s21_bench::Measure([&] {
+                      for (std::size_t i = 0; i < kWrites; ++i) {
+                        long long key = static_cast<long long>(gen() % n);
+                        persistent.insert_or_assign(key, -key);
+                      }
+                    }));
+  snapshot.clear();
+  s21_bench::Report("  writes with no snapshot", kWrites,
+                    s21_bench::Measure([&] {
+                      for (std::size_t i = 0; i < kWrites; ++i) {
+                        long long key = static_cast<long long>(gen() % n);
+                        persistent.insert_or_assign(key, key);
+                      }
+                    }));
+  s21_bench::Report("  s21::map insert_or_assign", kWrites,
+                    s21_bench::Measure([&] {
+                      for (std::size_t i = 0; i < kWrites; ++i) {
+                        long long key = static_cast<long long>(gen() % n);
+                        state.insert_or_assign(key, key);
+                      }
+                    }));
+  return 0;
+}
@@ -0,0 +1,82 @@
+#include <random>
+
+#include "../s21_list.h"
+#include "../s21_priority_queue.h"
+#include "s21_bench.h"
+
+// Scheduler-like workload: n pushes of random priorities followed by n pops
+// of the top element. The "sorted list" variant keeps s21::List ordered on
+// every insert (O(n) per push), which is what the schedulers did before.
+
+namespace {
+
+s21::Vector<int> RandomKeys(std::size_t n) {
+  std::mt19937 gen(42);
+  s21::Vector<int> keys;
+  keys.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys.push_back(static_cast<int>(gen()));
+  }
+  return keys;
+}
+
+void SortedList(const s21::Vector<int> &keys) {
+  s21::List<int> list;
+  for (int key : keys) {
+    auto it = list.begin();
+    while (it != list.end() && *it > key) {
+      ++it;
+    }
+    list.insert(it, key);
+  }
+  long long sum = 0;
+  while (!list.empty()) {
+    sum += list.front();
+    list.pop_front();
+  }
+  s21_bench::DoNotOptimize(sum);
+}
+
+template <std::size_t Arity>
+void Heap(const s21::Vector<int> &keys) {
+  s21::PriorityQueue<int, s21::Vector<int>, std::less<int>, Arity> que;
+  for (int key : keys) {
+    que.push(key);
+  }
+  long long sum = 0;
+  while (!que.empty()) {
+    sum += que.top();
+    que.pop();
+  }
+  s21_bench::DoNotOptimize(sum);
+}
+
+void BulkHeap(const s21::Vector<int> &keys) {
+  s21::PriorityQueue<int> que(keys.begin(), keys.end());
+  s21_bench::DoNotOptimize(que.top());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 1000000);
+  // the sorted list is quadratic, so it only gets a small slice of the input
+  std::size_t list_n = n < 20000 ? n : 20000;
+
+  s21::Vector<int> keys = RandomKeys(n);
+  s21::Vector<int> list_keys = RandomKeys(list_n);
+
+  s21_bench::Report("sorted s21::List push+pop", list_n,
+                    s21_bench::Measure([&] { SortedList(list_keys); }));
+  s21_bench::Report("PriorityQueue<2> push+pop", list_n,
+                    s21_bench::Measure([&] { Heap<2>(list_keys); }));
+  s21_bench::Report("PriorityQueue<2> push+pop", n,
+                    s21_bench::Measure([&] { Heap<2>(keys); }));
+  s21_bench::Report("PriorityQueue<4> push+pop", n,
+                    s21_bench::Measure([&] { Heap<4>(keys); }));
+  s21_bench::Report("PriorityQueue<8> push+pop", n,
+                    s21_bench::Measure([&] { Heap<8>(keys); }));
+  s21_bench::Report("PriorityQueue range constructor (make_heap)", n,
+                    s21_bench::Measure([&] { BulkHeap(keys); }));
+  return 0;
+}
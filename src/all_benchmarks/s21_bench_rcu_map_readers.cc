@@ -0,0 +1,95 @@
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_map.h"
+#include "../s21_rcu_map.h"
+#include "s21_bench.h"
+
+// Reader scaling of the lock-free rcu_map against s21::map behind a
+// std::shared_mutex. Every reader thread does n random lookups in a map of
+// 100000 keys while one writer changes a key about every 100 microseconds.
+// The time is for all readers together; with one core per reader the ideal
+// is a flat line.
+
+namespace {
+
+const int kKeys = 100000;
+
+struct LockedMap {
+  bool find(int key, long long &out) {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto pos = map.lower_bound(key);
+    if (pos == map.end() || (*pos).first != key) return false;
+    out = (*pos).second;
+    return true;
+  }
+  void insert_or_assign(int key, long long value) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    map.insert_or_assign(key, value);
+  }
+
+  std::shared_mutex mutex;
+  s21::map<int, long long> map;
+};
+
+template <typename Map>
+void Run(const char *name, Map &map, unsigned threads, std::size_t n) {
+  std::atomic<bool> stop(false);
+  std::thread writer([&map, &stop] {
+    std::mt19937 gen(2);
+    while (!stop.load(std::memory_order_relaxed)) {
+      map.insert_or_assign(static_cast<int>(gen() % kKeys), gen());
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+  });
+
+  std::atomic<std::size_t> found(0);
+  double ms = s21_bench::Measure([&] {
+    std::vector<std::thread> readers;
+    for (unsigned t = 0; t < threads; ++t) {
+      readers.emplace_back([&map, &found, n, t] {
+        std::mt19937 gen(t);
+        std::size_t hits = 0;
+        long long value = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+          hits += map.find(static_cast<int>(gen() % kKeys), value);
+        }
+        found += hits;
+      });
+    }
+    for (auto &reader : readers) reader.join();
+  });
+  stop = true;
+  writer.join();
+
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s, %u readers", name, threads);
+  s21_bench::Report(label, n * threads, ms);
+  s21_bench::DoNotOptimize(found.load());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 500000);
+  unsigned max_threads = std::thread::hardware_concurrency();
+  if (max_threads < 4) max_threads = 4;
+
+  s21::rcu_map<int, long long> rcu;
+  LockedMap locked;
+  rcu.update([](s21::rcu_map<int, long long>::version_type &next) {
+    for (int key = 0; key < kKeys; ++key) next.insert(key, key);
+  });
+  for (int key = 0; key < kKeys; ++key) locked.map.insert(key, key);
+
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+    Run("rcu_map find", rcu, threads, n);
+    Run("map + shared_mutex find", locked, threads, n);
+  }
+  return 0;
+}
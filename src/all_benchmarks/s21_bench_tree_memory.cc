@@ -0,0 +1,82 @@
+#include <cstdlib>
+#include <new>
+#include <random>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include "../s21_map.h"
+#include "../s21_set.h"
+#include "s21_bench.h"
+
+// Memory per element of the red-black containers. "requested" is what the
+// tree asks operator new for (sizeof the node); "malloc" is the usable size
+// of the blocks glibc hands back plus its 8-byte chunk header, i.e. what the
+// process really pays per node. Keys are random, so every insert allocates.
+
+namespace {
+
+std::size_t requested_bytes = 0;
+std::size_t malloc_bytes = 0;
+
+template <typename Container>
+void Run(const char *name, std::size_t node_size, const int *keys,
+         std::size_t n) {
+  Container container;
+  std::size_t requested = requested_bytes;
+  std::size_t used = malloc_bytes;
+  double ms = s21_bench::Measure([&] {
+    for (std::size_t i = 0; i < n; ++i) container.insert(keys[i]);
+  });
+  double size = static_cast<double>(container.size());
+  std::printf("%s: node %zu bytes, requested %.1f, malloc %.1f bytes/elem\n",
+              name, node_size,
+              static_cast<double>(requested_bytes - requested) / size,
+              static_cast<double>(malloc_bytes - used) / size);
+  s21_bench::Report("  insert random keys", n, ms);
+}
+
+// map::insert(key) does not exist, wrap it so Run can call insert(key)
+template <typename Key, typename Value, bool Counted = false>
+struct MapOf : s21::map<Key, Value, Counted> {
+  void insert(const Key &key) {
+    s21::map<Key, Value, Counted>::insert(key, Value());
+  }
+};
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+  requested_bytes += size;
+  void *ptr = std::malloc(size);
+  if (ptr == nullptr) throw std::bad_alloc();
+#if defined(__GLIBC__)
+  malloc_bytes += malloc_usable_size(ptr) + sizeof(std::size_t);
+#endif
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 1000000);
+
+  std::mt19937 gen(1);
+  int *keys = new int[n];
+  for (std::size_t i = 0; i < n; ++i) keys[i] = static_cast<int>(gen());
+
+  Run<s21::set<int>>("s21::set<int>", sizeof(s21::Node<int>), keys, n);
+  Run<MapOf<int, int>>("s21::map<int, int>", sizeof(s21::Node<int, int>),
+                       keys, n);
+  Run<MapOf<long long, long long>>("s21::map<long long, long long>",
+                                   sizeof(s21::Node<long long, long long>),
+                                   keys, n);
+  Run<MapOf<int, int, true>>("s21::map<int, int, true>",
+                             sizeof(s21::Node<int, int, true>), keys, n);
+
+  delete[] keys;
+  return 0;
+}
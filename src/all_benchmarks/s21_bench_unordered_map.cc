@@ -0,0 +1,51 @@
+#include <random>
+
+#include "../s21_map.h"
+#include "../s21_unordered_map.h"
+#include "s21_bench.h"
+
+// Exact-match lookups by order id: the red-black s21::map against the
+// open-addressing s21::unordered_map. Ids are random 64-bit numbers, half of
+// the lookups miss.
+
+namespace {
+
+template <typename Map>
+void Run(const char *name, const long long *ids, const long long *queries,
+         std::size_t n) {
+  Map orders;
+  s21_bench::Report(name, n, s21_bench::Measure([&] {
+                      for (std::size_t i = 0; i < n; ++i) {
+                        orders.insert(ids[i], static_cast<int>(i));
+                      }
+                    }));
+
+  std::size_t found = 0;
+  double ms = s21_bench::Measure([&] {
+    for (std::size_t i = 0; i < n; ++i) found += orders.contains(queries[i]);
+  });
+  s21_bench::Report("  contains, 50% hits", n, ms);
+  s21_bench::DoNotOptimize(found);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::ElementCount(argc, argv, 1000000);
+
+  std::mt19937_64 gen(1);
+  long long *ids = new long long[n];
+  long long *queries = new long long[n];
+  for (std::size_t i = 0; i < n; ++i) ids[i] = static_cast<long long>(gen());
+  for (std::size_t i = 0; i < n; ++i) {
+    queries[i] = i % 2 == 0 ? ids[gen() % n] : static_cast<long long>(gen());
+  }
+
+  Run<s21::map<long long, int>>("s21::map insert", ids, queries, n);
+  Run<s21::unordered_map<long long, int>>("s21::unordered_map insert", ids,
+                                          queries, n);
+
+  delete[] ids;
+  delete[] queries;
+  return 0;
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include "../s21_array.h"
+#include "array"
+#include "type_traits"
+
+// таблица квадратов, посчитанная на этапе компиляции
+constexpr s21::array<int, 8> MakeSquares() {
+  s21::array<int, 8> table;
+  for (std::size_t i = 0; i < table.size(); ++i) {
+    table[i] = static_cast<int>(i * i);
+  }
+  return table;
+}
+
+constexpr s21::array<int, 8> kSquares = MakeSquares();
+static_assert(kSquares[3] == 9, "constexpr operator[]");
+static_assert(kSquares.at(7) == 49, "constexpr at");
+static_assert(kSquares.front() == 0 && kSquares.back() == 49, "front/back");
+static_assert(std::is_trivially_copyable<s21::array<int, 4>>::value,
+              "array of trivially copyable T is trivially copyable");
+static_assert(!std::is_trivially_copyable<s21::array<std::string, 4>>::value,
+              "array of std::string is not");
+static_assert(sizeof(s21::array<int, 4>) == 4 * sizeof(int), "no overhead");
+
+TEST(Array, DefaultConstructor) {
+  s21::array<int, 5> arr;
+  std::array<int, 5> std_arr{};
+
+  EXPECT_EQ(arr.size(), std_arr.size());
+  EXPECT_EQ(arr.max_size(), std_arr.max_size());
+  EXPECT_EQ(arr.empty(), std_arr.empty());
+  for (std::size_t i = 0; i < arr.size(); ++i) {
+    EXPECT_EQ(arr[i], 0);
+  }
+}
+
+TEST(Array, EmptyArray) {
+  s21::array<int, 0> arr;
+
+  EXPECT_TRUE(arr.empty());
+  EXPECT_EQ(arr.size(), 0U);
+  EXPECT_EQ(arr.begin(), arr.end());
+}
+
+TEST(Array, InitializerListConstructor) {
+  s21::array<std::string, 4> arr{"a", "b", "c"};
+
+  EXPECT_EQ(arr[0], "a");
+  EXPECT_EQ(arr.at(2), "c");
+  EXPECT_EQ(arr.back(), "");
+  EXPECT_THROW(arr.at(4), std::out_of_range);
+  EXPECT_THROW((s21::array<int, 2>{1, 2, 3}), std::out_of_range);
+}
+
+TEST(Array, CopyMoveAssign) {
+  s21::array<std::string, 3> arr{"1", "2", "3"};
+  s21::array<std::string, 3> copy(arr);
+  s21::array<std::string, 3> moved(std::move(copy));
+  s21::array<std::string, 3> assigned;
+
+  EXPECT_EQ(moved[1], "2");
+  assigned = std::move(moved);
+  EXPECT_EQ(assigned[2], "3");
+  assigned = arr;
+  EXPECT_EQ(assigned[0], "1");
+}
+
+TEST(Array, IteratorsAndData) {
+  s21::array<int, 4> arr{4, 3, 2, 1};
+  int sum = 0;
+
+  for (int value : arr) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, 10);
+  EXPECT_EQ(arr.data(), arr.begin());
+  EXPECT_EQ(arr.end() - arr.begin(), 4);
+  *arr.data() = 40;
+  EXPECT_EQ(arr.front(), 40);
+}
+
+TEST(Array, FillAndSwap) {
+  s21::array<int, 3> arr1;
+  s21::array<int, 3> arr2{7, 8, 9};
+
+  arr1.fill(5);
+  arr1.swap(arr2);
+  EXPECT_EQ(arr1[0], 7);
+  EXPECT_EQ(arr1[2], 9);
+  EXPECT_EQ(arr2[1], 5);
+}
@@ -0,0 +1,281 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../s21_btree_map.h"
+#include "../s21_btree_set.h"
+
+namespace {
+
+// маленькие узлы, чтобы деления и слияния происходили на каждом шаге
+using SmallTree = s21::BTree<int, int, 4>;
+
+// проверяет свойства B+ дерева: ключи упорядочены и лежат в границах
+// разделителей, в узлах (кроме корня) не меньше N / 2 - 1 ключей, все листья
+// на одной глубине; возвращает глубину, листья складывает в leaves
+int CheckNode(SmallTree::node_type *node, bool is_root, const int *lo,
+              const int *hi, std::vector<SmallTree::leaf_type *> &leaves) {
+  if (!is_root) {
+    EXPECT_GE(node->count, 1U);
+  }
+  EXPECT_LE(node->count, 4U);
+  for (size_t i = 0; i < node->count; ++i) {
+    if (i > 0) {
+      EXPECT_LT(node->keys[i - 1], node->keys[i]);
+    }
+    if (lo != nullptr) {
+      EXPECT_LE(*lo, node->keys[i]);
+    }
+    if (hi != nullptr) {
+      EXPECT_LT(node->keys[i], *hi);
+    }
+  }
+  if (node->is_leaf) {
+    leaves.push_back(static_cast<SmallTree::leaf_type *>(node));
+    return 1;
+  }
+  auto *inner = static_cast<SmallTree::inner_type *>(node);
+  int depth = -1;
+  for (size_t i = 0; i <= inner->count; ++i) {
+    const int *child_lo = i == 0 ? lo : &inner->keys[i - 1];
+    const int *child_hi = i == inner->count ? hi : &inner->keys[i];
+    int child =
+        CheckNode(inner->children[i], false, child_lo, child_hi, leaves);
+    if (depth != -1) {
+      EXPECT_EQ(child, depth);
+    }
+    depth = child;
+  }
+  return depth + 1;
+}
+
+void CheckTree(SmallTree &tree, const std::map<int, int> &expected) {
+  ASSERT_EQ(tree.GetSize(), expected.size());
+  std::vector<SmallTree::leaf_type *> leaves;
+  if (tree.GetRoot() != nullptr) {
+    CheckNode(tree.GetRoot(), true, nullptr, nullptr, leaves);
+  }
+  // список листьев совпадает с обходом дерева слева направо
+  SmallTree::leaf_type *leaf = tree.GetFirst();
+  for (size_t i = 0; i < leaves.size(); ++i, leaf = leaf->next) {
+    ASSERT_EQ(leaf, leaves[i]);
+    ASSERT_EQ(leaf->prev, i == 0 ? nullptr : leaves[i - 1]);
+  }
+  ASSERT_EQ(leaf, nullptr);
+  ASSERT_EQ(tree.GetLast(), leaves.empty() ? nullptr : leaves.back());
+
+  s21::BTreeIterator<int, int, 4> iter(tree.GetFirst(), 0, &tree);
+  for (auto &item : expected) {
+    ASSERT_EQ((*iter).first, item.first);
+    ASSERT_EQ((*iter).second, item.second);
+    ++iter;
+  }
+  ASSERT_EQ(iter.leaf_, nullptr);
+}
+
+}  // namespace
+
+TEST(BTree, RandomInsertRemove) {
+  std::mt19937 gen(3);
+  SmallTree tree;
+  std::map<int, int> expected;
+
+  for (int i = 0; i < 5000; ++i) {
+    int key = gen() % 400;
+    if (gen() % 2 == 0) {
+      auto r = tree.Insert(key);
+      auto std_r = expected.insert({key, i});
+      ASSERT_EQ(r.second, std_r.second);
+      if (r.second) r.first.first->vals[r.first.second] = i;
+      ASSERT_EQ(r.first.first->keys[r.first.second], key);
+    } else {
+      ASSERT_EQ(tree.Remove(key), expected.erase(key) == 1);
+    }
+    if (i % 500 == 0) CheckTree(tree, expected);
+  }
+  CheckTree(tree, expected);
+
+  SmallTree copy(tree);
+  CheckTree(copy, expected);
+  for (auto &item : expected) tree.Remove(item.first);
+  CheckTree(tree, {});
+  CheckTree(copy, expected);
+}
+
+TEST(BTree, SortedInsertAndBounds) {
+  SmallTree tree;
+  std::map<int, int> expected;
+  for (int key = 0; key < 1000; key += 2) {
+    tree.Insert(key);
+    expected[key] = 0;
+  }
+  CheckTree(tree, expected);
+
+  for (int key = -1; key <= 1000; ++key) {
+    auto lower = tree.LowerBound(key);
+    auto upper = tree.UpperBound(key);
+    auto std_lower = expected.lower_bound(key);
+    auto std_upper = expected.upper_bound(key);
+    if (std_lower == expected.end()) {
+      ASSERT_EQ(lower.first, nullptr);
+    } else {
+      ASSERT_EQ(lower.first->keys[lower.second], std_lower->first);
+    }
+    if (std_upper == expected.end()) {
+      ASSERT_EQ(upper.first, nullptr);
+    } else {
+      ASSERT_EQ(upper.first->keys[upper.second], std_upper->first);
+    }
+    ASSERT_EQ(tree.Search(key).first != nullptr, expected.count(key) == 1);
+  }
+}
+
+TEST(BTreeMap, InsertAtBrackets) {
+  s21::btree_map<int, std::string> map{{3, "c"}, {1, "a"}, {2, "b"}};
+
+  EXPECT_EQ(map.size(), 3U);
+  EXPECT_EQ(map.at(1), "a");
+  EXPECT_THROW(map.at(7), std::out_of_range);
+  EXPECT_FALSE(map.insert(2, "x").second);
+  EXPECT_EQ(map[2], "b");
+  map[7] = "g";
+  EXPECT_EQ(map.at(7), "g");
+  EXPECT_EQ(map.insert_or_assign(1, "A").first->second, "A");
+  EXPECT_EQ(map.size(), 4U);
+
+  std::string keys;
+  for (auto item : map) keys += item.second;
+  EXPECT_EQ(keys, "Abcg");
+  EXPECT_EQ((*--map.end()).first, 7);
+}
+
+TEST(BTreeMap, FindEraseContains) {
+  s21::btree_map<int, int> map;
+  std::map<int, int> std_map;
+  for (int key = 0; key < 2000; ++key) {
+    map.insert(key * 7 % 2000, key);
+    std_map.insert({key * 7 % 2000, key});
+  }
+  for (int key = 0; key < 2000; key += 3) {
+    map.erase(map.find(key));
+    std_map.erase(key);
+  }
+
+  EXPECT_EQ(map.size(), std_map.size());
+  EXPECT_FALSE(map.contains(3));
+  EXPECT_TRUE(map.contains(4));
+  EXPECT_EQ(map.find(3), map.end());
+  EXPECT_EQ(map.lower_bound(3)->first, 4);
+  EXPECT_EQ(map.upper_bound(4)->first, 5);
+  auto std_iter = std_map.begin();
+  for (auto iter = map.begin(); iter != map.end(); ++iter, ++std_iter) {
+    ASSERT_EQ(iter->first, std_iter->first);
+    ASSERT_EQ(iter->second, std_iter->second);
+  }
+}
+
+namespace {
+
+// считает копии, перемещения бесплатны
+struct CountedValue {
+  static int copies;
+  int value = 0;
+  CountedValue() = default;
+  explicit CountedValue(int v) : value(v) {}
+  CountedValue(const CountedValue &other) : value(other.value) { ++copies; }
+  CountedValue(CountedValue &&other) = default;
+  CountedValue &operator=(const CountedValue &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  CountedValue &operator=(CountedValue &&other) = default;
+};
+int CountedValue::copies = 0;
+
+}  // namespace
+
+// merge перемещает значения, а не копирует их
+TEST(BTreeMap, MergeMovesValues) {
+  s21::btree_map<int, CountedValue> map;
+  s21::btree_map<int, CountedValue> other;
+  for (int key = 0; key < 300; key += 2) map[key] = CountedValue(key);
+  for (int key = 0; key < 300; key += 3) other[key] = CountedValue(-key);
+
+  CountedValue::copies = 0;
+  map.merge(other);
+  EXPECT_EQ(CountedValue::copies, 0);
+  EXPECT_EQ(map.size(), 200U);
+  EXPECT_EQ(other.size(), 50U);
+  EXPECT_EQ(map.at(3).value, -3);
+  EXPECT_EQ(map.at(6).value, 6);
+  EXPECT_EQ(other.at(6).value, -6);
+  EXPECT_FALSE(other.contains(3));
+}
+
+TEST(BTreeMap, CopyMoveSwapMerge) {
+  s21::btree_map<int, int> map1{{1, 10}, {2, 20}};
+  s21::btree_map<int, int> map2{{2, 0}, {3, 30}};
+  s21::btree_map<int, int> copy(map1);
+
+  map1.merge(map2);
+  EXPECT_EQ(map1.size(), 3U);
+  EXPECT_EQ(map1.at(2), 20);
+  EXPECT_EQ(map2.size(), 1U);
+  EXPECT_EQ(map2.at(2), 0);
+  EXPECT_EQ(copy.size(), 2U);
+
+  s21::btree_map<int, int> moved(std::move(map1));
+  EXPECT_EQ(moved.size(), 3U);
+  EXPECT_TRUE(map1.empty());
+  moved.swap(map1);
+  EXPECT_EQ(map1.at(3), 30);
+  map1 = std::move(copy);
+  EXPECT_EQ(map1.size(), 2U);
+  map1.clear();
+  EXPECT_TRUE(map1.empty());
+  EXPECT_EQ(map1.begin(), map1.end());
+}
+
+TEST(BTreeSet, AgainstStdSet) {
+  std::mt19937 gen(9);
+  s21::btree_set<int> set;
+  std::set<int> std_set;
+  for (int i = 0; i < 20000; ++i) {
+    int key = gen() % 3000;
+    if (gen() % 3 != 0) {
+      ASSERT_EQ(set.insert(key).second, std_set.insert(key).second);
+    } else if (set.contains(key)) {
+      set.erase(set.find(key));
+      std_set.erase(key);
+    }
+  }
+
+  ASSERT_EQ(set.size(), std_set.size());
+  auto std_iter = std_set.begin();
+  for (int key : set) {
+    ASSERT_EQ(key, *std_iter++);
+  }
+  std_iter = std_set.end();
+  for (auto iter = set.end(); iter != set.begin();) {
+    ASSERT_EQ(*--iter, *--std_iter);
+  }
+}
+
+TEST(BTreeSet, StringsAndMerge) {
+  s21::btree_set<std::string> set1{"pear", "apple"};
+  s21::btree_set<std::string> set2{"fig", "apple"};
+
+  set1.merge(set2);
+  EXPECT_EQ(set1.size(), 3U);
+  EXPECT_EQ(set2.size(), 1U);
+  EXPECT_EQ(*set2.begin(), "apple");
+  EXPECT_EQ(*set1.begin(), "apple");
+  EXPECT_EQ(*set1.equal_range("fig").first, "fig");
+  EXPECT_EQ(set1.equal_range("fig").second, set1.find("pear"));
+  EXPECT_EQ(set1.max_size(), set2.max_size());
+}
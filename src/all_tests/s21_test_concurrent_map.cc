@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_map.h"
+#include "../s21_map.h"
+
+namespace {
+
+using HashShards = s21::concurrent_map<int, long long, 8>;
+using TreeShards =
+    s21::concurrent_map<int, long long, 4, s21::map<int, long long>>;
+
+template <typename Map>
+void CheckInterface() {
+  Map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert(1, 10));
+  EXPECT_FALSE(map.insert(1, 11));
+  EXPECT_TRUE(map.insert_or_assign(2, 20));
+  EXPECT_FALSE(map.insert_or_assign(2, 21));
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_FALSE(map.contains(3));
+
+  long long value = 0;
+  EXPECT_TRUE(map.find(2, [&value](const long long &item) { value = item; }));
+  EXPECT_EQ(value, 21);
+  EXPECT_FALSE(map.find(3, [&value](const long long &) { value = -1; }));
+  EXPECT_EQ(value, 21);
+
+  EXPECT_TRUE(map.update(3, 0, [](long long &item) { item += 5; }));
+  EXPECT_FALSE(map.update(3, 0, [](long long &item) { item += 5; }));
+  EXPECT_TRUE(map.find(3, [&value](const long long &item) { value = item; }));
+  EXPECT_EQ(value, 10);
+
+  EXPECT_EQ(map.erase(1), 1U);
+  EXPECT_EQ(map.erase(1), 0U);
+  EXPECT_EQ(map.size(), 2U);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+// потоки увеличивают общие счетчики; после них каждый счетчик равен
+// числу потоков, как в std::map после тех же операций подряд
+template <typename Map>
+void CheckConcurrentUpdates() {
+  const int kThreads = 4;
+  const int kKeys = 1000;
+  Map map;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&map, t] {
+      for (int key = 0; key < kKeys; ++key) {
+        map.update(key, 0, [](long long &item) { ++item; });
+        map.insert_or_assign(kKeys + t * kKeys + key, key);
+        if (key % 2 == 0) map.erase(kKeys + t * kKeys + key);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  std::map<int, long long> expected;
+  for (int key = 0; key < kKeys; ++key) expected[key] = kThreads;
+  for (int t = 0; t < kThreads; ++t) {
+    for (int key = 1; key < kKeys; key += 2) {
+      expected[kKeys + t * kKeys + key] = key;
+    }
+  }
+  std::map<int, long long> seen;
+  map.for_each([&seen](const int &key, long long &value) {
+    EXPECT_TRUE(seen.emplace(key, value).second);
+  });
+  EXPECT_EQ(seen, expected);
+  EXPECT_EQ(map.size(), expected.size());
+}
+
+}  // namespace
+
+TEST(ConcurrentMap, HashShardInterface) { CheckInterface<HashShards>(); }
+
+TEST(ConcurrentMap, TreeShardInterface) { CheckInterface<TreeShards>(); }
+
+TEST(ConcurrentMap, SingleShard) {
+  CheckInterface<s21::concurrent_map<int, long long, 1>>();
+}
+
+TEST(ConcurrentMap, HashShardConcurrentUpdates) {
+  CheckConcurrentUpdates<HashShards>();
+}
+
+TEST(ConcurrentMap, TreeShardConcurrentUpdates) {
+  CheckConcurrentUpdates<TreeShards>();
+}
+
+TEST(ConcurrentMap, TreeShardsKeepKeysOrdered) {
+  TreeShards map;
+  for (int key = 100; key > 0; --key) map.insert(key, key);
+  int shards_seen = 0;
+  int last = 0;
+  map.for_each([&](const int &key, long long &value) {
+    EXPECT_EQ(key, value);
+    if (key < last) ++shards_seen;  // начался следующий шард
+    last = key;
+  });
+  EXPECT_LT(shards_seen, static_cast<int>(TreeShards::shard_count()));
+}
+
+TEST(ConcurrentMap, StringKeys) {
+  s21::concurrent_map<std::string, int> map;
+  map.insert("session-1", 1);
+  map.update("session-1", 0, [](int &hits) { hits += 2; });
+  int hits = 0;
+  EXPECT_TRUE(map.find("session-1", [&hits](const int &item) { hits = item; }));
+  EXPECT_EQ(hits, 3);
+}
+
+// int main(int argc, char **argv) {
+//   testing::InitGoogleTest(&argc, argv);
+//   return RUN_ALL_TESTS();
+// }
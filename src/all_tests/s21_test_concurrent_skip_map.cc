@@ -0,0 +1,218 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_skip_map.h"
+
+namespace {
+
+using SkipMap = s21::concurrent_skip_map<int, int>;
+
+template <typename StdMap>
+void ExpectSame(const SkipMap &map, const StdMap &expected) {
+  ASSERT_EQ(map.size(), expected.size());
+  auto iter = map.begin();
+  for (auto &item : expected) {
+    ASSERT_EQ(iter->first, item.first);
+    ASSERT_EQ(iter->second, item.second);
+    ++iter;
+  }
+  ASSERT_EQ(iter, map.end());
+}
+
+}  // namespace
+
+TEST(ConcurrentSkipMap, MapInterface) {
+  s21::concurrent_skip_map<std::string, int> map{{"b", 2}, {"a", 1}};
+  EXPECT_EQ(map.size(), 2U);
+  EXPECT_EQ(map.begin()->first, "a");
+
+  auto result = map.insert("c", 3);
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(result.first->second, 3);
+  result = map.insert("c", 4);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(result.first->second, 3);
+
+  EXPECT_TRUE(map.contains("b"));
+  EXPECT_EQ(map.find("b")->second, 2);
+  EXPECT_EQ(map.find("bb"), map.end());
+  EXPECT_EQ(map.lower_bound("bb")->first, "c");
+  EXPECT_EQ(map.lower_bound("d"), map.end());
+
+  EXPECT_EQ(map.erase("b"), 1U);
+  EXPECT_EQ(map.erase("b"), 0U);
+  EXPECT_FALSE(map.contains("b"));
+  EXPECT_EQ(map.size(), 2U);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(ConcurrentSkipMap, AgainstStdMap) {
+  SkipMap map;
+  std::map<int, int> expected;
+  std::mt19937 gen(50);
+  for (int i = 0; i < 20000; ++i) {
+    int key = gen() % 2000;
+    switch (gen() % 3) {
+      case 0:
+      case 1:
+        EXPECT_EQ(map.insert(key, i).second, expected.emplace(key, i).second);
+        break;
+      default:
+        EXPECT_EQ(map.erase(key), expected.erase(key));
+    }
+    int probe = gen() % 2100;
+    auto pos = map.lower_bound(probe);
+    auto std_pos = expected.lower_bound(probe);
+    if (std_pos == expected.end()) {
+      EXPECT_EQ(pos, map.end());
+    } else {
+      ASSERT_NE(pos, map.end());
+      EXPECT_EQ(pos->first, std_pos->first);
+    }
+  }
+  ExpectSame(map, expected);
+}
+
+// Все потоки вставляют и удаляют одни и те же ключи. Для каждого ключа
+// успешные вставки и удаления чередуются в порядке линеаризации, поэтому
+// вставок столько же, сколько удалений, или на одну больше - и тогда ключ
+// остался в словаре
+TEST(ConcurrentSkipMap, ContendedInsertEraseHistory) {
+  const int kThreads = 4;
+  const int kKeys = 64;
+  SkipMap map;
+  std::atomic<int> inserted[kKeys];
+  std::atomic<int> erased[kKeys];
+  for (int key = 0; key < kKeys; ++key) {
+    inserted[key] = 0;
+    erased[key] = 0;
+  }
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      std::mt19937 gen(t);
+      for (int i = 0; i < 20000; ++i) {
+        int key = gen() % kKeys;
+        if (gen() % 2 == 0) {
+          if (map.insert(key, t).second) ++inserted[key];
+        } else {
+          if (map.erase(key) == 1) ++erased[key];
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  size_t present = 0;
+  for (int key = 0; key < kKeys; ++key) {
+    int balance = inserted[key] - erased[key];
+    EXPECT_TRUE(balance == 0 || balance == 1) << "key " << key;
+    EXPECT_EQ(map.contains(key), balance == 1) << "key " << key;
+    present += balance;
+  }
+  EXPECT_EQ(map.size(), present);
+}
+
+// ровно одна из одновременных вставок (и удалений) ключа успешна
+TEST(ConcurrentSkipMap, OneWinnerPerKey) {
+  const int kThreads = 4;
+  const int kKeys = 5000;
+  SkipMap map;
+  std::atomic<int> wins(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&map, &wins, t] {
+      for (int key = 0; key < kKeys; ++key) wins += map.insert(key, t).second;
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(wins.load(), kKeys);
+  EXPECT_EQ(map.size(), static_cast<size_t>(kKeys));
+
+  threads.clear();
+  wins = 0;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&map, &wins] {
+      for (int key = kKeys - 1; key >= 0; --key) {
+        wins += static_cast<int>(map.erase(key));
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(wins.load(), kKeys);
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+// Четные ключи вставлены заранее и не меняются, нечетные вставляются и
+// удаляются писателями. Каждый обход идет по возрастанию ключей и видит
+// все четные ключи
+TEST(ConcurrentSkipMap, ScansDuringWrites) {
+  const int kKeys = 2000;
+  SkipMap map;
+  for (int key = 0; key < kKeys; key += 2) map.insert(key, key);
+  std::atomic<bool> stop(false);
+  std::atomic<int> bad(0);
+
+  std::vector<std::thread> writers;
+  for (int t = 0; t < 2; ++t) {
+    writers.emplace_back([&map, &stop, t] {
+      std::mt19937 gen(t);
+      while (!stop.load()) {
+        int key = static_cast<int>(gen() % (kKeys / 2)) * 2 + 1;
+        if (gen() % 2 == 0) {
+          map.insert(key, key);
+        } else {
+          map.erase(key);
+        }
+      }
+    });
+  }
+  for (int scan = 0; scan < 200; ++scan) {
+    int last = -1;
+    int even = 0;
+    for (auto pos = map.begin(); pos != map.end(); ++pos) {
+      if (pos->first <= last || pos->second != pos->first) ++bad;
+      if (pos->first % 2 == 0) ++even;
+      last = pos->first;
+    }
+    if (even != kKeys / 2) ++bad;
+    auto pos = map.lower_bound(kKeys / 2 + 1);
+    if (pos == map.end() || pos->first < kKeys / 2 + 1) ++bad;
+  }
+  stop = true;
+  for (auto &writer : writers) writer.join();
+  EXPECT_EQ(bad.load(), 0);
+}
+
+// итератор остается рабочим, когда его элемент и соседи удалены
+TEST(ConcurrentSkipMap, IteratorSurvivesErase) {
+  SkipMap map{{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+  auto pos = map.find(2);
+  map.erase(2);
+  map.erase(3);
+  EXPECT_EQ(pos->first, 2);
+  ++pos;
+  ASSERT_NE(pos, map.end());
+  EXPECT_EQ(pos->first, 4);
+  for (int key = 10; key < 200; ++key) {
+    map.insert(key, key);
+    map.erase(key);
+  }
+  ++pos;
+  EXPECT_EQ(pos, map.end());
+}
+
+// int main(int argc, char **argv) {
+//   testing::InitGoogleTest(&argc, argv);
+//   return RUN_ALL_TESTS();
+// }
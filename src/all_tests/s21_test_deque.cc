@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include "../s21_deque.h"
+#include "../s21_queue.h"
+#include "../s21_stack.h"
+#include "algorithm"
+#include "deque"
+#include "random"
+
+using MyTypes = testing::Types<int, double, std::deque<int>, std::string>;
+
+template <typename T>
+class DequeTest : public testing::Test {
+ protected:
+  s21::Deque<T> deq;
+  std::deque<T> std_deq;
+};
+
+TYPED_TEST_SUITE(DequeTest, MyTypes);
+TYPED_TEST(DequeTest, DefaultConstructor) {
+  s21::Deque<TypeParam> deq;
+  std::deque<TypeParam> std_deq;
+
+  EXPECT_EQ(deq.size(), std_deq.size());
+  EXPECT_EQ(deq.empty(), std_deq.empty());
+  EXPECT_TRUE(deq.begin() == deq.end());
+}
+
+TYPED_TEST(DequeTest, SizeConstructor) {
+  s21::Deque<TypeParam> deq(1000);
+  std::deque<TypeParam> std_deq(1000);
+
+  EXPECT_EQ(deq.size(), std_deq.size());
+  EXPECT_EQ(deq.front(), std_deq.front());
+  EXPECT_EQ(deq.back(), std_deq.back());
+}
+
+TEST(DequeConstructor, InitializerListConstructor) {
+  s21::Deque<int> deq{1, 2, 3, 4, 5};
+
+  EXPECT_EQ(deq.size(), 5U);
+  EXPECT_EQ(deq.front(), 1);
+  EXPECT_EQ(deq.back(), 5);
+  EXPECT_EQ(deq[2], 3);
+  EXPECT_EQ(deq.at(4), 5);
+  EXPECT_THROW(deq.at(5), std::out_of_range);
+}
+
+TEST(DequeConstructor, CopyAndMove) {
+  s21::Deque<std::string> original{"1", "2", "3"};
+  s21::Deque<std::string> copy(original);
+  copy.push_front("0");
+
+  EXPECT_EQ(original.size(), 3U);
+  EXPECT_EQ(copy.size(), 4U);
+  EXPECT_EQ(copy.front(), "0");
+
+  s21::Deque<std::string> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 4U);
+  EXPECT_EQ(copy.size(), 0U);
+
+  s21::Deque<std::string> assigned;
+  assigned = original;
+  EXPECT_EQ(assigned.back(), "3");
+  assigned = std::move(moved);
+  EXPECT_EQ(assigned.size(), 4U);
+  EXPECT_EQ(assigned.front(), "0");
+}
+
+TEST(DequeMethods, PushPopBothEnds) {
+  s21::Deque<int> deq;
+  std::deque<int> std_deq;
+
+  for (int i = 0; i < 10000; ++i) {
+    deq.push_back(i);
+    std_deq.push_back(i);
+    deq.push_front(-i);
+    std_deq.push_front(-i);
+  }
+  ASSERT_EQ(deq.size(), std_deq.size());
+  for (size_t i = 0; i < deq.size(); ++i) {
+    ASSERT_EQ(deq[i], std_deq[i]);
+  }
+  while (!std_deq.empty()) {
+    ASSERT_EQ(deq.front(), std_deq.front());
+    ASSERT_EQ(deq.back(), std_deq.back());
+    deq.pop_front();
+    std_deq.pop_front();
+    if (!std_deq.empty()) {
+      deq.pop_back();
+      std_deq.pop_back();
+    }
+  }
+  EXPECT_TRUE(deq.empty());
+}
+
+TEST(DequeMethods, StableReferences) {
+  s21::Deque<int> deq{1, 2, 3};
+  int &first = deq.front();
+  int &last = deq.back();
+
+  for (int i = 0; i < 50000; ++i) {
+    deq.push_back(i);
+    deq.push_front(i);
+  }
+  EXPECT_EQ(first, 1);
+  EXPECT_EQ(last, 3);
+  EXPECT_EQ(&first, &deq[50000]);
+}
+
+TEST(DequeMethods, InsertErase) {
+  s21::Deque<int> deq{1, 2, 3, 4, 5};
+  std::deque<int> std_deq{1, 2, 3, 4, 5};
+
+  auto it = deq.insert(deq.begin() + 1, 10);
+  std_deq.insert(std_deq.begin() + 1, 10);
+  EXPECT_EQ(*it, 10);
+  deq.insert(deq.end() - 1, 20);
+  std_deq.insert(std_deq.end() - 1, 20);
+  deq.insert(deq.begin(), deq.back());
+  std_deq.insert(std_deq.begin(), std_deq.back());
+
+  it = deq.erase(deq.begin() + 2);
+  std_deq.erase(std_deq.begin() + 2);
+  EXPECT_EQ(*it, 2);
+  deq.erase(deq.end() - 2);
+  std_deq.erase(std_deq.end() - 2);
+
+  ASSERT_EQ(deq.size(), std_deq.size());
+  EXPECT_TRUE(std::equal(deq.begin(), deq.end(), std_deq.begin()));
+}
+
+TEST(DequeMethods, RandomInsertErase) {
+  std::mt19937 gen(3);
+  s21::Deque<int> deq;
+  std::deque<int> std_deq;
+
+  for (int i = 0; i < 3000; ++i) {
+    size_t pos = std_deq.empty() ? 0 : gen() % (std_deq.size() + 1);
+    if (gen() % 3 != 0 || std_deq.empty()) {
+      deq.insert(deq.begin() + pos, i);
+      std_deq.insert(std_deq.begin() + pos, i);
+    } else {
+      pos %= std_deq.size();
+      deq.erase(deq.begin() + pos);
+      std_deq.erase(std_deq.begin() + pos);
+    }
+  }
+  ASSERT_EQ(deq.size(), std_deq.size());
+  EXPECT_TRUE(std::equal(deq.begin(), deq.end(), std_deq.begin()));
+}
+
+TEST(DequeMethods, IteratorsWithAlgorithms) {
+  s21::Deque<int> deq{5, 3, 9, 1, 7};
+  std::sort(deq.begin(), deq.end());
+
+  const s21::Deque<int> &cdeq = deq;
+  EXPECT_TRUE(std::is_sorted(cdeq.begin(), cdeq.end()));
+  EXPECT_EQ(cdeq.end() - cdeq.begin(), 5);
+  EXPECT_EQ(*(deq.end() - 1), 9);
+  EXPECT_EQ(deq.begin()[1], 3);
+}
+
+TEST(DequeMethods, ClearSwap) {
+  s21::Deque<int> deq1{1, 2, 3};
+  s21::Deque<int> deq2{4};
+
+  deq1.swap(deq2);
+  EXPECT_EQ(deq1.size(), 1U);
+  EXPECT_EQ(deq2.size(), 3U);
+
+  deq2.clear();
+  EXPECT_TRUE(deq2.empty());
+  deq2.push_front(8);
+  deq2.push_back(9);
+  EXPECT_EQ(deq2.front(), 8);
+  EXPECT_EQ(deq2.back(), 9);
+}
+
+TEST(DequeAsContainer, Stack) {
+  s21::Stack<int, s21::Deque<int>> stack{1, 2, 3};
+
+  stack.push(4);
+  EXPECT_EQ(stack.top(), 4);
+  stack.pop();
+  stack.pop();
+  EXPECT_EQ(stack.top(), 2);
+  EXPECT_EQ(stack.size(), 2U);
+}
+
+TEST(DequeAsContainer, Queue) {
+  s21::Queue<std::string, s21::Deque<std::string>> que{"1", "2", "3"};
+
+  que.push("4");
+  EXPECT_EQ(que.front(), "1");
+  EXPECT_EQ(que.back(), "4");
+  que.pop();
+  EXPECT_EQ(que.front(), "2");
+  EXPECT_EQ(que.size(), 3U);
+}
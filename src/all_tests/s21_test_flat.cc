@@ -0,0 +1,232 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_flat_map.h"
+#include "../s21_flat_set.h"
+
+TEST(FlatMap, BulkConstructionSortsAndDedups) {
+  s21::flat_map<int, std::string> map{
+      {5, "five"}, {1, "one"}, {3, "three"}, {1, "uno"}, {4, "four"}};
+  std::map<int, std::string> std_map{
+      {5, "five"}, {1, "one"}, {3, "three"}, {1, "uno"}, {4, "four"}};
+
+  ASSERT_EQ(map.size(), std_map.size());
+  auto std_iter = std_map.begin();
+  for (auto iter = map.begin(); iter != map.end(); ++iter, ++std_iter) {
+    EXPECT_EQ(iter->first, std_iter->first);
+    EXPECT_EQ(iter->second, std_iter->second);
+  }
+  EXPECT_EQ(map.at(1), "one");
+  EXPECT_THROW(map.at(2), std::out_of_range);
+}
+
+TEST(FlatMap, MapInterface) {
+  s21::flat_map<std::string, int> map;
+
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert("b", 2).second);
+  EXPECT_FALSE(map.insert(std::make_pair("b", 20)).second);
+  map["a"] = 1;
+  map["c"];
+  EXPECT_EQ(map.size(), 3U);
+  EXPECT_EQ(map.at("c"), 0);
+  EXPECT_EQ(map.insert_or_assign("b", 22).first->second, 22);
+  EXPECT_TRUE(map.contains("a"));
+  EXPECT_FALSE(map.contains("d"));
+  EXPECT_EQ(map.find("c")->first, "c");
+  EXPECT_EQ(map.find("d"), map.end());
+  EXPECT_EQ(map.lower_bound("bb")->first, "c");
+  EXPECT_EQ(map.upper_bound("a")->first, "b");
+  EXPECT_EQ((*--map.end()).first, "c");
+
+  map.erase(map.find("b"));
+  EXPECT_EQ(map.size(), 2U);
+  EXPECT_EQ(map.at("c"), 0);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  map["z"] = 26;
+  EXPECT_EQ(map.at("z"), 26);
+}
+
+TEST(FlatMap, BatchedInsertAndMerge) {
+  s21::flat_map<int, int> map{{10, 1}, {20, 2}, {30, 3}};
+  std::vector<std::pair<int, int>> batch{{25, 0}, {5, 0}, {20, 99}, {5, 7}};
+
+  map.insert(batch.begin(), batch.end());
+  EXPECT_EQ(map.size(), 5U);
+  EXPECT_EQ(map.at(20), 2);
+  EXPECT_EQ(map.at(5), 0);
+  EXPECT_EQ(map.begin()->first, 5);
+
+  s21::flat_map<int, int> other{{1, 1}, {30, 0}, {40, 4}};
+  map.merge(other);
+  EXPECT_EQ(map.size(), 7U);
+  EXPECT_EQ(map.at(30), 3);
+  EXPECT_EQ(map.at(40), 4);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at(30), 0);
+}
+
+TEST(FlatMap, CopyMoveSwap) {
+  s21::flat_map<int, int> map{{1, 1}, {2, 2}};
+  s21::flat_map<int, int> copy(map);
+  s21::flat_map<int, int> moved(std::move(map));
+  s21::flat_map<int, int> other{{3, 3}};
+
+  EXPECT_EQ(copy.size(), 2U);
+  EXPECT_EQ(moved.size(), 2U);
+  EXPECT_TRUE(map.empty());
+  moved.swap(other);
+  EXPECT_EQ(moved.at(3), 3);
+  EXPECT_EQ(other.at(2), 2);
+  map = std::move(copy);
+  EXPECT_EQ(map.at(1), 1);
+  EXPECT_EQ(map.max_size(), other.max_size());
+}
+
+TEST(FlatMap, RandomAgainstStdMap) {
+  std::mt19937 gen(2);
+  s21::flat_map<int, int> map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 3000; ++i) {
+    int key = gen() % 500;
+    if (gen() % 3 != 0) {
+      ASSERT_EQ(map.insert(key, i).second, std_map.insert({key, i}).second);
+    } else if (map.contains(key)) {
+      map.erase(map.find(key));
+      std_map.erase(key);
+    }
+  }
+  ASSERT_EQ(map.size(), std_map.size());
+  auto std_iter = std_map.begin();
+  for (auto iter = map.begin(); iter != map.end(); ++iter, ++std_iter) {
+    ASSERT_EQ(iter->first, std_iter->first);
+    ASSERT_EQ(iter->second, std_iter->second);
+  }
+}
+
+// элементы other с новыми ключами переходят в map, остальные остаются,
+// как у std::map::merge
+TEST(FlatMap, MergeAgainstStdMap) {
+  std::mt19937 gen(41);
+  for (int round = 0; round < 50; ++round) {
+    s21::flat_map<int, int> map;
+    s21::flat_map<int, int> other;
+    std::map<int, int> std_map;
+    std::map<int, int> std_other;
+    for (int i = 0; i < 40; ++i) {
+      int key = gen() % 60;
+      map.insert(key, i);
+      std_map.insert({key, i});
+      key = gen() % 60;
+      other.insert(key, -i);
+      std_other.insert({key, -i});
+    }
+    map.merge(other);
+    std_map.merge(std_other);
+    ASSERT_EQ(map.size(), std_map.size());
+    ASSERT_EQ(other.size(), std_other.size());
+    for (auto &item : std_map) ASSERT_EQ(map.at(item.first), item.second);
+    for (auto &item : std_other) ASSERT_EQ(other.at(item.first), item.second);
+  }
+}
+
+namespace {
+
+// значение, копия которого бросает, когда запас копий исчерпан
+struct ThrowingValue {
+  static int copies_left;
+  int value;
+  ThrowingValue(int v = 0) : value(v) {}
+  ThrowingValue(const ThrowingValue &other) : value(other.value) { Spend(); }
+  ThrowingValue &operator=(const ThrowingValue &other) {
+    Spend();
+    value = other.value;
+    return *this;
+  }
+  ThrowingValue &operator=(ThrowingValue &&other) = default;
+  static void Spend() {
+    if (--copies_left < 0) throw std::runtime_error("copy failed");
+  }
+};
+int ThrowingValue::copies_left = 1 << 30;
+
+}  // namespace
+
+// неудачная вставка не оставляет ключ без значения: ключи и значения
+// остаются на одних и тех же номерах
+TEST(FlatMap, ThrowingInsertKeepsArraysAligned) {
+  s21::flat_map<int, ThrowingValue> map;
+  std::map<int, int> expected;
+  for (int key = 0; key < 40; key += 2) {
+    map.insert(key, ThrowingValue(key));
+    expected.insert({key, key});
+  }
+  for (int key = 1; key < 40; key += 2) {
+    ThrowingValue::copies_left = 0;
+    EXPECT_THROW(map.insert(key, ThrowingValue(key)), std::runtime_error);
+    ThrowingValue::copies_left = 1 << 30;
+    ASSERT_EQ(map.size(), expected.size());
+    for (auto &item : expected) {
+      ASSERT_EQ(map.at(item.first).value, item.second);
+    }
+  }
+  map.insert(1, ThrowingValue(1));
+  EXPECT_EQ(map.at(1).value, 1);
+  EXPECT_EQ(map.at(2).value, 2);
+}
+
+TEST(FlatSet, BulkAndBatchedInsert) {
+  std::mt19937 gen(4);
+  std::vector<int> input;
+  for (int i = 0; i < 2000; ++i) input.push_back(gen() % 700);
+  s21::flat_set<int> set(input.begin(), input.end());
+  std::set<int> std_set(input.begin(), input.end());
+
+  std::vector<int> batch;
+  for (int i = 0; i < 500; ++i) batch.push_back(gen() % 1000);
+  set.insert(batch.begin(), batch.end());
+  std_set.insert(batch.begin(), batch.end());
+
+  ASSERT_EQ(set.size(), std_set.size());
+  auto std_iter = std_set.begin();
+  for (int key : set) {
+    ASSERT_EQ(key, *std_iter++);
+  }
+}
+
+TEST(FlatSet, SetInterface) {
+  s21::flat_set<std::string> set{"pear", "apple", "pear"};
+
+  EXPECT_EQ(set.size(), 2U);
+  EXPECT_TRUE(set.insert("fig").second);
+  EXPECT_FALSE(set.insert("apple").second);
+  EXPECT_EQ(*set.begin(), "apple");
+  EXPECT_TRUE(set.contains("fig"));
+  EXPECT_EQ(set.find("kiwi"), set.end());
+  EXPECT_EQ(*set.equal_range("fig").second, "pear");
+  EXPECT_EQ(*set.upper_bound("fig"), "pear");
+
+  set.erase(set.find("fig"));
+  EXPECT_FALSE(set.contains("fig"));
+
+  s21::flat_set<std::string> other{"banana", "pear"};
+  set.merge(other);
+  EXPECT_EQ(set.size(), 3U);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(*other.begin(), "pear");
+  set.swap(other);
+  EXPECT_EQ(set.size(), 1U);
+  s21::flat_set<std::string> copy(other);
+  set = std::move(copy);
+  EXPECT_EQ(set.size(), 3U);
+  set.clear();
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.begin(), set.end());
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include "../s21_indexed_priority_queue.h"
+#include "functional"
+#include "map"
+#include "random"
+
+using MinQueue = s21::IndexedPriorityQueue<int, std::greater<int>>;
+
+TEST(IndexedPriorityQueue, DefaultConstructor) {
+  MinQueue que;
+
+  EXPECT_TRUE(que.empty());
+  EXPECT_EQ(que.size(), 0U);
+  EXPECT_FALSE(que.contains(0));
+}
+
+TEST(IndexedPriorityQueue, PushPop) {
+  MinQueue que;
+  auto h5 = que.push(5);
+  auto h1 = que.push(1);
+  auto h3 = que.push(3);
+
+  EXPECT_EQ(que.size(), 3U);
+  EXPECT_EQ(que.top(), 1);
+  EXPECT_EQ(que.top_handle(), h1);
+  EXPECT_EQ(que.at(h5), 5);
+  EXPECT_EQ(que.at(h3), 3);
+
+  que.pop();
+  EXPECT_FALSE(que.contains(h1));
+  EXPECT_EQ(que.top(), 3);
+  EXPECT_THROW(que.at(h1), std::out_of_range);
+}
+
+TEST(IndexedPriorityQueue, UpdateDecreaseAndIncrease) {
+  MinQueue que;
+  auto h10 = que.push(10);
+  auto h20 = que.push(20);
+  que.push(30);
+
+  que.update(h20, 5);  // decrease key: поднимается наверх
+  EXPECT_EQ(que.top_handle(), h20);
+  EXPECT_EQ(que.at(h20), 5);
+
+  que.update(h20, 50);  // increase key: опускается вниз
+  EXPECT_EQ(que.top_handle(), h10);
+  EXPECT_EQ(que.at(h20), 50);
+  EXPECT_THROW(que.update(100, 1), std::out_of_range);
+}
+
+TEST(IndexedPriorityQueue, EraseAndHandleReuse) {
+  MinQueue que;
+  auto h1 = que.push(1);
+  auto h2 = que.push(2);
+  que.push(3);
+
+  que.erase(h2);
+  EXPECT_EQ(que.size(), 2U);
+  EXPECT_FALSE(que.contains(h2));
+  EXPECT_THROW(que.erase(h2), std::out_of_range);
+
+  auto h4 = que.push(4);
+  EXPECT_EQ(h4, h2);
+  EXPECT_EQ(que.at(h4), 4);
+  EXPECT_EQ(que.at(h1), 1);
+}
+
+TEST(IndexedPriorityQueue, EmplaceCopySwapClear) {
+  s21::IndexedPriorityQueue<std::string> que;
+  auto ha = que.emplace(2, 'a');
+  que.emplace("b");
+
+  s21::IndexedPriorityQueue<std::string> copy(que);
+  copy.update(ha, "z");
+  EXPECT_EQ(copy.top(), "z");
+  EXPECT_EQ(que.top(), "b");
+
+  s21::IndexedPriorityQueue<std::string> other;
+  other.swap(que);
+  EXPECT_TRUE(que.empty());
+  EXPECT_EQ(other.size(), 2U);
+
+  other.clear();
+  EXPECT_TRUE(other.empty());
+  EXPECT_FALSE(other.contains(ha));
+}
+
+// случайные операции сверяются с std::multimap<priority, handle>
+TEST(IndexedPriorityQueue, RandomAgainstMultimap) {
+  std::mt19937 gen(7);
+  MinQueue que;
+  std::map<MinQueue::handle_type, int> alive;
+
+  for (int i = 0; i < 3000; ++i) {
+    int op = gen() % 4;
+    int value = gen() % 1000;
+    if (op == 0 || alive.empty()) {
+      alive[que.push(value)] = value;
+    } else {
+      auto it = alive.begin();
+      std::advance(it, gen() % alive.size());
+      if (op == 1) {
+        que.update(it->first, value);
+        it->second = value;
+      } else if (op == 2) {
+        que.erase(it->first);
+        alive.erase(it);
+      } else {
+        int top = que.top();
+        auto handle = que.top_handle();
+        ASSERT_EQ(alive.at(handle), top);
+        que.pop();
+        alive.erase(handle);
+      }
+    }
+    ASSERT_EQ(que.size(), alive.size());
+    int best = 1000;
+    for (auto &item : alive) {
+      ASSERT_EQ(que.at(item.first), item.second);
+      best = std::min(best, item.second);
+    }
+    if (!alive.empty()) {
+      ASSERT_EQ(que.top(), best);
+    }
+  }
+}
@@ -3,6 +3,9 @@
 
 #include <iostream>
 #include <map>
+#include <random>
+#include <string>
+#include <vector>
 
 #include "../s21_map.h"
 
@@ -14,7 +17,8 @@ TEST(Map, DefaultConstructor) {
 TEST(Map, InitializerListConstructor) {
   s21::map<int, std::string> m{{1, "one"}, {2, "two"}, {3, "three"}};
   EXPECT_EQ(m.size(), 3);
-  EXPECT_EQ(m.GetTree().GetRoot()->key, 1);
+  // после балансировки корнем становится средний ключ
+  EXPECT_EQ(m.GetTree().GetRoot()->GetKey(), 2);
   EXPECT_EQ(m.at(1), "one");
 }
 
@@ -60,6 +64,158 @@ TEST(Map, Brackets) {
   EXPECT_EQ(map[2], "TWO");
 }
 
+TEST(Map, BracketsInsertDefault) {
+  s21::map<std::string, int> counts;
+
+  // пустой словарь: ключ вставляется, значение - 0
+  EXPECT_EQ(counts["a"], 0);
+  EXPECT_EQ(counts.size(), 1U);
+  for (const char *word : {"b", "a", "c", "a", "b", "a"}) counts[word]++;
+  EXPECT_EQ(counts.size(), 3U);
+  EXPECT_EQ(counts.at("a"), 3);
+  EXPECT_EQ(counts.at("b"), 2);
+  EXPECT_EQ(counts.at("c"), 1);
+}
+
+TEST(Map, TryEmplace) {
+  s21::map<int, std::string> map{{1, "one"}};
+
+  auto r = map.try_emplace(2, 3, 'x');
+  EXPECT_TRUE(r.second);
+  EXPECT_EQ(r.first->first, 2);
+  EXPECT_EQ(map.at(2), "xxx");
+
+  r = map.try_emplace(1, "uno");
+  EXPECT_FALSE(r.second);
+  EXPECT_EQ(r.first->second, "one");
+
+  auto iter = map.emplace_hint(map.end(), 5, "five");
+  EXPECT_EQ(iter->first, 5);
+  EXPECT_EQ(map.emplace_hint(map.begin(), 5, "FIVE")->second, "five");
+  EXPECT_EQ(map.size(), 3U);
+}
+
+// итератор отдает пару <const ключ, значение>, хранящуюся прямо в узле
+TEST(Map, IteratorYieldsPairs) {
+  s21::map<std::string, int> map{{"b", 2}, {"a", 1}, {"c", 3}};
+  std::string keys;
+  for (auto &item : map) {
+    keys += item.first;
+    item.second *= 10;
+  }
+  EXPECT_EQ(keys, "abc");
+  EXPECT_EQ(map.at("b"), 20);
+  EXPECT_EQ(map.begin()->second, 10);
+  EXPECT_EQ(&map.lower_bound("c")->second, &map.at("c"));
+}
+
+// обратный обход и шаг назад из end() после поворотов при вставке
+TEST(Map, ReverseIteration) {
+  s21::map<int, int> map;
+  for (int key = 0; key < 100; ++key) map.insert(key, -key);
+
+  int expected = 99;
+  for (auto iter = map.rbegin(); iter != map.rend(); ++iter, --expected) {
+    ASSERT_EQ(iter->first, expected);
+    ASSERT_EQ(iter->second, -expected);
+  }
+  EXPECT_EQ(expected, -1);
+  EXPECT_EQ((--map.end())->first, 99);
+
+  map.erase(map.begin());
+  map.erase(--map.end());
+  EXPECT_EQ(map.begin()->first, 1);
+  EXPECT_EQ(map.rbegin()->first, 98);
+
+  s21::map<int, int> other{{500, 5}};
+  map.swap(other);
+  EXPECT_EQ(map.rbegin()->first, 500);
+  EXPECT_EQ(other.begin()->first, 1);
+}
+
+// конструктор из неотсортированного диапазона: из равных ключей остается
+// первый, как при повторных insert
+TEST(Map, RangeConstructor) {
+  std::vector<std::pair<int, std::string>> items = {
+      {5, "five"}, {1, "one"}, {3, "three"}, {1, "uno"}, {4, "four"}};
+  s21::map<int, std::string> map(items.begin(), items.end());
+
+  EXPECT_EQ(map.size(), 4U);
+  EXPECT_EQ(map.at(1), "one");
+  std::string keys;
+  for (auto &item : map) keys += std::to_string(item.first);
+  EXPECT_EQ(keys, "1345");
+
+  s21::map<int, std::string> empty(items.begin(), items.begin());
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.begin(), empty.end());
+}
+
+TEST(Map, AssignSorted) {
+  std::map<int, int> std_map;
+  for (int key = 0; key < 5000; key += 5) std_map[key] = key / 5;
+
+  s21::map<int, int, true> map{{-1, -1}};
+  map.assign_sorted(std_map.begin(), std_map.end());
+  EXPECT_EQ(map.size(), std_map.size());
+  EXPECT_FALSE(map.contains(-1));
+  EXPECT_EQ(map.at(4995), 999);
+  EXPECT_EQ(map.nth(500)->first, 2500);
+  EXPECT_EQ(map.rank(2501), 501U);
+
+  // после построения дерево принимает обычные вставки и удаления
+  map[2] = 2;
+  map.erase(map.lower_bound(0));
+  EXPECT_EQ(map.begin()->first, 2);
+  EXPECT_EQ(map.rbegin()->first, 4995);
+  EXPECT_EQ(map.size(), std_map.size());
+}
+
+// merge переносит узлы: адреса значений не меняются, а элементы с уже
+// имеющимися ключами остаются в other
+TEST(Map, MergeMovesNodes) {
+  s21::map<int, std::string> map{{1, "one"}, {3, "three"}};
+  s21::map<int, std::string> other{{2, "two"}, {3, "drei"}, {4, "four"}};
+  std::string *two = &other.at(2);
+
+  map.merge(other);
+  EXPECT_EQ(map.size(), 4U);
+  EXPECT_EQ(&map.at(2), two);
+  EXPECT_EQ(map.at(3), "three");
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at(3), "drei");
+  EXPECT_EQ(other.begin()->first, 3);
+  EXPECT_EQ(other.rbegin()->first, 3);
+
+  map.merge(map);
+  EXPECT_EQ(map.size(), 4U);
+  s21::map<int, std::string> empty;
+  empty.merge(map);
+  EXPECT_EQ(empty.size(), 4U);
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(Map, SetAlgebra) {
+  s21::map<int, std::string> a{{1, "a1"}, {2, "a2"}, {4, "a4"}};
+  s21::map<int, std::string> b{{2, "b2"}, {3, "b3"}, {4, "b4"}, {5, "b5"}};
+
+  s21::map<int, std::string> united = set_union(a, b);
+  EXPECT_EQ(united.size(), 5U);
+  EXPECT_EQ(united.at(2), "a2");
+  EXPECT_EQ(united.at(5), "b5");
+
+  s21::map<int, std::string> common = set_intersection(a, b);
+  EXPECT_EQ(common.size(), 2U);
+  EXPECT_EQ(common.at(4), "a4");
+  EXPECT_FALSE(common.contains(1));
+
+  s21::map<int, std::string> only_a = set_difference(a, b);
+  EXPECT_EQ(only_a.size(), 1U);
+  EXPECT_EQ(only_a.at(1), "a1");
+  EXPECT_EQ(a.size(), 3U);
+  EXPECT_EQ(b.size(), 4U);
+}
+
 TEST(Map, Clear) {
   s21::map<int, std::string> map = {{1, "one"}, {2, "two"}, {3, "three"}};
   ASSERT_EQ(map.size(), 3);
@@ -85,8 +241,8 @@ TEST(Map, InsertPair1) {
 
   EXPECT_EQ(m1.insert(1, 3).second, m2.insert(2, 3).second);
   EXPECT_EQ(m1.size(), m2.size());
-  EXPECT_EQ(m1.GetTree().GetRoot()->key, 1);
-  EXPECT_EQ(m2.GetTree().GetRoot()->key, 2);
+  EXPECT_EQ(m1.GetTree().GetRoot()->GetKey(), 1);
+  EXPECT_EQ(m2.GetTree().GetRoot()->GetKey(), 2);
 }
 
 TEST(Map, Insert_or_assign) {
@@ -111,14 +267,15 @@ TEST(Map, Erase_and_Begin) {
   EXPECT_EQ(m1.at(10), "десять");
 
   auto iter = m1.begin();
-  EXPECT_EQ(iter.node_->key, 1);
+  EXPECT_EQ(iter->first, 1);
 
-  auto iter2 = m1.end();
-  EXPECT_EQ(iter2.node_->key, 12);
+  auto iter2 = --m1.end();
+  EXPECT_EQ(iter2->first, 12);
+  EXPECT_EQ(++iter2, m1.end());
 
   m1.erase(iter);
   EXPECT_EQ(m1.size(), 3);
-  EXPECT_EQ(m1.begin().node_->key, 2);
+  EXPECT_EQ(m1.begin()->first, 2);
 }
 
 TEST(Map, Swap) {
@@ -153,7 +310,7 @@ TEST(Map, Merge) {
   m1.merge(m2);
   EXPECT_EQ(m1.size(), 6);
   //   EXPECT_EQ(m2.tree_in_map.size, 4);
-  //   EXPECT_EQ(m2.tree_in_map.root->val, "десять");
+  //   EXPECT_EQ(m2.tree_in_map.root->value.second, "десять");
   //   EXPECT_EQ(m2.tree_in_map.max, 12);
   //   EXPECT_EQ(m2.tree_in_map.min, 1);
 }
@@ -167,6 +324,361 @@ TEST(Map, Contains) {
   EXPECT_FALSE(map.contains(3));
 }
 
+TEST(Map, Find) {
+  s21::map<int, std::string> map = {{10, "a"}, {20, "b"}};
+
+  EXPECT_EQ(map.find(20)->second, "b");
+  EXPECT_EQ(map.find(15), map.end());
+  map.find(10)->second = "c";
+  EXPECT_EQ(map.at(10), "c");
+}
+
+TEST(Map, Bounds) {
+  s21::map<int, std::string> map = {{10, "a"}, {20, "b"}, {30, "c"}};
+
+  EXPECT_EQ(map.lower_bound(20)->second, "b");
+  EXPECT_EQ(map.lower_bound(15)->first, 20);
+  EXPECT_EQ(map.upper_bound(20)->first, 30);
+  EXPECT_EQ(map.upper_bound(30), map.end());
+  EXPECT_EQ(map.lower_bound(31), map.end());
+  EXPECT_EQ(map.lower_bound(-5)->first, 10);
+
+  auto range = map.equal_range(20);
+  EXPECT_EQ(range.first->first, 20);
+  EXPECT_EQ(range.second->first, 30);
+  range = map.equal_range(25);
+  EXPECT_EQ(range.first, range.second);
+}
+
+TEST(Map, Range) {
+  s21::map<int, int> map;
+  std::map<int, int> std_map;
+  for (int key = 0; key < 1000; key += 3) {
+    map.insert(key, key * 2);
+    std_map.insert({key, key * 2});
+  }
+
+  auto std_iter = std_map.lower_bound(100);
+  int n = 0;
+  for (auto &item : map.range(100, 200)) {
+    EXPECT_EQ(item.first, std_iter->first);
+    ++std_iter;
+    ++n;
+  }
+  EXPECT_EQ(std_iter, std_map.lower_bound(200));
+  EXPECT_EQ(n, 33);
+  EXPECT_TRUE(map.range(200, 100).empty());
+  EXPECT_TRUE(map.range(1000, 2000).empty());
+  EXPECT_FALSE(map.range(998, 2000).empty());
+}
+
+TEST(Map, OrderStatistics) {
+  s21::map<int, int, true> map;
+  std::map<int, int> std_map;
+  for (int key = 999; key >= 0; key -= 3) {
+    map.insert(key, key * 2);
+    std_map.insert({key, key * 2});
+  }
+  map.erase(map.lower_bound(300));
+  std_map.erase(300);
+
+  EXPECT_EQ(map.size(), std_map.size());
+  size_t index = 0;
+  for (auto &item : std_map) {
+    ASSERT_EQ(map.nth(index)->first, item.first);
+    ASSERT_EQ(map.nth(index)->second, item.second);
+    ASSERT_EQ(map.rank(item.first), index);
+    ++index;
+  }
+  EXPECT_EQ(map.nth(index), map.end());
+  EXPECT_EQ(map.rank(301), 100U);
+  EXPECT_EQ(map.distance(map.lower_bound(100), map.lower_bound(400)), 99U);
+  EXPECT_EQ(map.distance(map.end(), map.end()), 0U);
+
+  s21::map<int, int, true> copy(map);
+  EXPECT_EQ(*copy.nth(200), *map.nth(200));
+}
+
+TEST(Map, IterateToEnd) {
+  s21::map<int, int> map;
+  EXPECT_EQ(map.begin(), map.end());
+
+  map = {{3, 3}, {1, 1}, {2, 2}};
+  int expected = 1;
+  for (auto iter = map.begin(); iter != map.end(); ++iter) {
+    EXPECT_EQ(iter->first, expected++);
+  }
+  EXPECT_EQ(expected, 4);
+}
+
+// копия не связана с исходным словарем: вставки с поворотами в копии
+// не меняют оригинал, значения копируются
+TEST(Map, CopyIsIndependent) {
+  s21::map<int, int> m1 = {{1, 10}, {2, 20}, {3, 30}};
+  s21::map<int, int> m2(m1);
+  for (int key = 4; key < 64; ++key) m2.insert(key, key * 10);
+
+  EXPECT_EQ(m1.size(), 3);
+  EXPECT_EQ(m2.size(), 63);
+  EXPECT_EQ(m2.at(2), 20);
+  int expected = 1;
+  for (auto iter = m1.begin(); iter != m1.end(); ++iter) {
+    EXPECT_EQ(iter->first, expected++);
+  }
+  EXPECT_EQ(expected, 4);
+}
+
+// запись переезжает на другой ключ без выделения памяти: узел и значение
+// остаются по тем же адресам
+TEST(Map, ExtractChangesKey) {
+  s21::map<int, std::string> orders = {{1, "buy"}, {2, "sell"}, {3, "hold"}};
+  const std::string *address = &orders.at(2);
+
+  auto node = orders.extract(2);
+  ASSERT_FALSE(node.empty());
+  EXPECT_EQ(orders.size(), 2U);
+  EXPECT_FALSE(orders.contains(2));
+  EXPECT_EQ(node.key(), 2);
+  EXPECT_EQ(node.mapped(), "sell");
+
+  node.key() = 10;
+  auto result = orders.insert(std::move(node));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(result.node.empty());
+  EXPECT_TRUE(node.empty());
+  EXPECT_EQ(result.position->first, 10);
+  EXPECT_EQ(&orders.at(10), address);
+  EXPECT_EQ(orders.size(), 3U);
+
+  int keys[] = {1, 3, 10};
+  int i = 0;
+  for (auto iter = orders.begin(); iter != orders.end(); ++iter) {
+    EXPECT_EQ(iter->first, keys[i++]);
+  }
+  EXPECT_EQ((--orders.end())->first, 10);
+}
+
+TEST(Map, ExtractMovesBetweenMaps) {
+  s21::map<int, int> from;
+  s21::map<int, int> to = {{5, 50}};
+  for (int key = 0; key < 100; ++key) from.insert(key, key * 10);
+
+  for (int key = 0; key < 100; key += 2) {
+    auto result = to.insert(from.extract(from.lower_bound(key)));
+    if (key == 4) {
+      EXPECT_TRUE(result.inserted);
+    }
+  }
+  EXPECT_EQ(from.size(), 50U);
+  EXPECT_EQ(to.size(), 51U);
+  EXPECT_EQ(to.at(98), 980);
+  EXPECT_EQ(to.begin()->first, 0);
+  EXPECT_EQ((--to.end())->first, 98);
+
+  // такой ключ уже есть: узел возвращается в дескрипторе, словарь не меняется
+  auto node = from.extract(5);
+  auto result = to.insert(std::move(node));
+  EXPECT_FALSE(result.inserted);
+  ASSERT_FALSE(result.node.empty());
+  EXPECT_EQ(result.node.mapped(), 50);
+  EXPECT_EQ(result.position->second, 50);
+  EXPECT_EQ(to.size(), 51U);
+  // узел из result.node освобождается деструктором дескриптора
+}
+
+TEST(Map, ExtractMissing) {
+  s21::map<int, int> map = {{1, 1}};
+  EXPECT_TRUE(map.extract(2).empty());
+  EXPECT_FALSE(map.extract(map.end()));
+  auto result = map.insert(s21::map<int, int>::node_type());
+  EXPECT_FALSE(result.inserted);
+  EXPECT_EQ(result.position, map.end());
+
+  s21::map<int, int>::node_type node = map.extract(map.begin());
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+  node = map.extract(1);
+  EXPECT_TRUE(node.empty());
+}
+
+// retention: все, что старше t, отрезается за O(log n); сверка с наивным
+// std::map, из которого старые записи удаляются по одной
+TEST(Map, SplitJoinAgainstNaive) {
+  std::mt19937 gen(23);
+  s21::map<int, int> orders;
+  std::map<int, int> naive;
+  for (int i = 0; i < 3000; ++i) {
+    int time = gen() % 10000;
+    orders.insert(time, i);
+    naive.insert({time, i});
+  }
+  for (int t = 0; t <= 10000; t += 1237) {
+    s21::map<int, int> newer = orders.split(t);
+    std::map<int, int> naive_newer(naive.lower_bound(t), naive.end());
+    naive.erase(naive.lower_bound(t), naive.end());
+
+    ASSERT_EQ(orders.size(), naive.size());
+    ASSERT_EQ(newer.size(), naive_newer.size());
+    auto iter = orders.begin();
+    for (auto &item : naive) {
+      ASSERT_EQ(iter->first, item.first);
+      ASSERT_EQ(iter->second, item.second);
+      ++iter;
+    }
+    iter = newer.begin();
+    for (auto &item : naive_newer) {
+      ASSERT_EQ(iter->first, item.first);
+      ASSERT_EQ(iter->second, item.second);
+      ++iter;
+    }
+    // старые записи отброшены, новые возвращаются: orders = orders.split(t)
+    // и join в обратном порядке
+    orders.swap(newer);
+    naive.swap(naive_newer);
+    orders.join(newer);
+    naive.insert(naive_newer.begin(), naive_newer.end());
+    ASSERT_TRUE(newer.empty());
+    ASSERT_EQ(orders.size(), naive.size());
+    ASSERT_EQ(orders.begin()->first, naive.begin()->first);
+    ASSERT_EQ(orders.rbegin()->first, naive.rbegin()->first);
+  }
+}
+
+TEST(Map, JoinOverlappingThrows) {
+  s21::map<int, int> a = {{1, 1}, {5, 5}};
+  s21::map<int, int> b = {{5, 50}, {9, 9}};
+  EXPECT_THROW(a.join(b), std::invalid_argument);
+  EXPECT_EQ(a.size(), 2U);
+  EXPECT_EQ(b.size(), 2U);
+  s21::map<int, int> c = a.split(5);
+  EXPECT_EQ(c.at(5), 5);
+  EXPECT_NO_THROW(a.join(b));
+  EXPECT_EQ(a.size(), 3U);
+  EXPECT_EQ(a.at(5), 50);
+}
+
+TEST(Map, EraseByKeyAndIterator) {
+  s21::map<int, int> map = {{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+  EXPECT_EQ(map.erase(2), 1U);
+  EXPECT_EQ(map.erase(2), 0U);
+  auto next = map.erase(map.begin());
+  EXPECT_EQ(next->first, 3);
+  EXPECT_EQ(map.erase(--map.end()), map.end());
+  EXPECT_EQ(map.erase(map.end()), map.end());
+  EXPECT_EQ(map.size(), 1U);
+  EXPECT_EQ(map.begin()->first, 3);
+}
+
+// удаление диапазона сверяется с std::map::erase(first, last)
+TEST(Map, RangeEraseAgainstStd) {
+  std::mt19937 gen(37);
+  s21::map<int, int> map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 20000; ++i) {
+    int key = gen() % 100000;
+    map.insert(key, i);
+    std_map.insert({key, i});
+  }
+  while (!std_map.empty()) {
+    int lo = gen() % 100000;
+    int hi = lo + gen() % 20000;
+    auto last = map.erase(map.lower_bound(lo), map.lower_bound(hi));
+    std_map.erase(std_map.lower_bound(lo), std_map.lower_bound(hi));
+    ASSERT_EQ(last, map.lower_bound(hi));
+    ASSERT_EQ(map.size(), std_map.size());
+    auto iter = map.begin();
+    for (auto &item : std_map) {
+      ASSERT_EQ(iter->first, item.first);
+      ASSERT_EQ(iter->second, item.second);
+      ++iter;
+    }
+    ASSERT_EQ(iter, map.end());
+    if (gen() % 8 == 0) {
+      map.erase(map.begin(), map.end());
+      std_map.clear();
+    }
+  }
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(Map, EraseIf) {
+  s21::map<int, int> map;
+  for (int key = 0; key < 1000; ++key) map.insert(key, key % 7);
+  // отдельные элементы и длинные подряд идущие серии
+  size_t erased = erase_if(map, [](const std::pair<const int, int> &item) {
+    return item.second == 3 || (item.first >= 200 && item.first < 700);
+  });
+  size_t expected = 500;
+  for (int key = 0; key < 1000; ++key) {
+    if (key % 7 == 3 && (key < 200 || key >= 700)) ++expected;
+  }
+  EXPECT_EQ(erased, expected);
+  EXPECT_EQ(map.size(), 1000U - expected);
+  for (auto iter = map.begin(); iter != map.end(); ++iter) {
+    EXPECT_NE(iter->second, 3);
+    EXPECT_TRUE(iter->first < 200 || iter->first >= 700);
+  }
+}
+
+// лента почти по возрастанию: подсказка end() или прошлый результат
+TEST(Map, HintedInsert) {
+  s21::map<int, int> map;
+  auto hint = map.end();
+  for (int key = 0; key < 1000; ++key) {
+    // каждый десятый ключ приходит с опозданием
+    int late = key % 10 == 9 ? key - 5 : key;
+    hint = map.emplace_hint(hint, late, key);
+    EXPECT_EQ(hint->first, late);
+  }
+  for (int key = 0; key < 1000; ++key) {
+    map.insert(map.end(), std::make_pair(key, -1));
+  }
+  EXPECT_EQ(map.size(), 1000U);
+  EXPECT_EQ(map.at(0), 0);
+  EXPECT_EQ(map.at(9), -1);
+  EXPECT_EQ(map.insert(map.begin(), std::make_pair(500, 0))->second, 500);
+  int expected = 0;
+  for (auto iter = map.begin(); iter != map.end(); ++iter) {
+    EXPECT_EQ(iter->first, expected++);
+  }
+  EXPECT_EQ(map.rbegin()->first, 999);
+}
+
+// копия живет дольше оригинала: обход в обе стороны не заходит в узлы
+// удаленного дерева (ASan поймал бы обращение к освобожденной памяти)
+TEST(Map, CopyOutlivesSource) {
+  std::mt19937 gen(53);
+  std::map<int, std::string> expected;
+  s21::map<int, std::string> *source = new s21::map<int, std::string>;
+  for (int i = 0; i < 5000; ++i) {
+    int key = gen() % 20000;
+    source->insert(key, std::to_string(key));
+    expected.insert({key, std::to_string(key)});
+  }
+  s21::map<int, std::string> copy(*source);
+  delete source;
+
+  ASSERT_EQ(copy.size(), expected.size());
+  EXPECT_EQ(copy.begin()->first, expected.begin()->first);
+  EXPECT_EQ(copy.rbegin()->first, expected.rbegin()->first);
+  auto iter = copy.begin();
+  for (auto &item : expected) {
+    ASSERT_EQ(iter->first, item.first);
+    ASSERT_EQ(iter->second, item.second);
+    ++iter;
+  }
+  EXPECT_EQ(iter, copy.end());
+  auto back = copy.rbegin();
+  for (auto item = expected.rbegin(); item != expected.rend(); ++item) {
+    ASSERT_EQ(back->first, item->first);
+    ++back;
+  }
+  copy.insert(-1, "x");
+  copy.erase(copy.lower_bound(0));
+  EXPECT_EQ(copy.begin()->first, -1);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include "../s21_multiset.h"
+#include "random"
+#include "set"
+
+TEST(Multiset, DefaultConstructor) {
+  s21::multiset<int> ms;
+
+  EXPECT_TRUE(ms.empty());
+  EXPECT_EQ(ms.size(), 0U);
+  EXPECT_TRUE(ms.begin() == ms.end());
+}
+
+TEST(Multiset, InitializerListKeepsDuplicates) {
+  s21::multiset<int> ms{3, 1, 3, 2, 3, 1};
+  std::multiset<int> std_ms{3, 1, 3, 2, 3, 1};
+
+  EXPECT_EQ(ms.size(), std_ms.size());
+  auto std_it = std_ms.begin();
+  for (auto it = ms.begin(); it != ms.end(); ++it, ++std_it) {
+    EXPECT_EQ(*it, *std_it);
+  }
+}
+
+TEST(Multiset, CopyMove) {
+  s21::multiset<std::string> ms{"b", "a", "b"};
+  s21::multiset<std::string> copy(ms);
+  s21::multiset<std::string> moved(std::move(ms));
+
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_EQ(moved.size(), 3U);
+  EXPECT_EQ(ms.size(), 0U);
+
+  s21::multiset<std::string> assigned;
+  assigned = std::move(moved);
+  EXPECT_EQ(assigned.count("b"), 2U);
+
+  s21::multiset<std::string> copied{"z"};
+  copied = copy;
+  copied.insert("c");
+  EXPECT_EQ(copied.size(), 4U);
+  EXPECT_EQ(copy.size(), 3U);
+  copied = copied;
+  EXPECT_EQ(copied.size(), 4U);
+}
+
+namespace {
+
+// ключи равны, если ни один не меньше другого; operator== у типа нет
+struct Version {
+  int major;
+  int minor;
+  bool operator<(const Version &other) const { return major < other.major; }
+};
+
+}  // namespace
+
+TEST(Multiset, EquivalenceByLess) {
+  s21::multiset<Version> ms{{1, 0}, {2, 0}, {2, 1}, {2, 5}, {3, 0}};
+
+  EXPECT_EQ(ms.count({2, 9}), 3U);
+  EXPECT_EQ((*ms.find({2, 9})).minor, 0);
+  EXPECT_TRUE(ms.find({4, 0}) == ms.end());
+  EXPECT_EQ(ms.erase(Version{2, 7}), 3U);
+  EXPECT_EQ(ms.size(), 2U);
+}
+
+TEST(Multiset, CountFindContains) {
+  s21::multiset<int> ms{5, 1, 5, 5, 9};
+
+  EXPECT_EQ(ms.count(5), 3U);
+  EXPECT_EQ(ms.count(1), 1U);
+  EXPECT_EQ(ms.count(7), 0U);
+  EXPECT_TRUE(ms.contains(9));
+  EXPECT_FALSE(ms.contains(2));
+  EXPECT_EQ(*ms.find(5), 5);
+  EXPECT_TRUE(ms.find(2) == ms.end());
+  // find возвращает первый из равных
+  EXPECT_TRUE(--ms.find(5) == ms.begin());
+}
+
+TEST(Multiset, Bounds) {
+  s21::multiset<int> ms{10, 20, 20, 30};
+
+  EXPECT_EQ(*ms.lower_bound(20), 20);
+  EXPECT_EQ(*ms.upper_bound(20), 30);
+  EXPECT_EQ(*ms.lower_bound(15), 20);
+  EXPECT_TRUE(ms.upper_bound(30) == ms.end());
+  EXPECT_TRUE(ms.lower_bound(31) == ms.end());
+
+  auto range = ms.equal_range(20);
+  int n = 0;
+  for (auto it = range.first; it != range.second; ++it) {
+    EXPECT_EQ(*it, 20);
+    ++n;
+  }
+  EXPECT_EQ(n, 2);
+  range = ms.equal_range(25);
+  EXPECT_TRUE(range.first == range.second);
+}
+
+TEST(Multiset, EraseSingleDuplicate) {
+  s21::multiset<int> ms{4, 4, 4, 2, 8};
+
+  ms.erase(ms.find(4));
+  EXPECT_EQ(ms.size(), 4U);
+  EXPECT_EQ(ms.count(4), 2U);
+  ms.erase(ms.begin());
+  EXPECT_EQ(*ms.begin(), 4);
+  EXPECT_TRUE(ms.erase(--ms.end()) == ms.end());
+  EXPECT_EQ(*--ms.end(), 4);
+  EXPECT_EQ(ms.size(), 2U);
+  EXPECT_EQ(*ms.erase(ms.begin()), 4);
+  EXPECT_EQ(ms.size(), 1U);
+}
+
+TEST(Multiset, EraseAllEqualKeys) {
+  s21::multiset<int> ms{5, 1, 5, 5, 9, 5};
+
+  EXPECT_EQ(ms.erase(5), 4U);
+  EXPECT_EQ(ms.erase(5), 0U);
+  EXPECT_EQ(ms.erase(7), 0U);
+  EXPECT_EQ(ms.size(), 2U);
+  EXPECT_EQ(*ms.begin(), 1);
+  EXPECT_EQ(*--ms.end(), 9);
+}
+
+TEST(Multiset, EraseRangeOfDuplicates) {
+  s21::multiset<int> ms = {1, 2, 2, 2, 2, 3, 3, 4};
+  auto first = ms.find(2);
+  ++first;
+  auto last = ms.find(3);
+  ++last;
+  EXPECT_EQ(*ms.erase(first, last), 3);
+  EXPECT_EQ(ms.size(), 4U);
+  EXPECT_EQ(ms.count(2), 1U);
+  EXPECT_EQ(ms.count(3), 1U);
+}
+
+TEST(Multiset, SwapMergeClear) {
+  s21::multiset<int> ms1{1, 2, 2};
+  s21::multiset<int> ms2{2, 3};
+
+  ms1.merge(ms2);
+  EXPECT_EQ(ms1.size(), 5U);
+  EXPECT_EQ(ms1.count(2), 3U);
+  EXPECT_TRUE(ms2.empty());
+
+  ms1.swap(ms2);
+  EXPECT_TRUE(ms1.empty());
+  EXPECT_EQ(ms2.size(), 5U);
+
+  ms2.clear();
+  EXPECT_TRUE(ms2.empty());
+  EXPECT_EQ(ms2.max_size(), ms1.max_size());
+}
+
+// гистограмма: случайные вставки и удаления сверяются с std::multiset
+TEST(Multiset, RandomAgainstStd) {
+  std::mt19937 gen(11);
+  s21::multiset<int> ms;
+  std::multiset<int> std_ms;
+
+  for (int i = 0; i < 2000; ++i) {
+    int key = gen() % 50;
+    if (gen() % 3 != 0) {
+      ms.insert(key);
+      std_ms.insert(key);
+    } else if (std_ms.count(key) != 0) {
+      ms.erase(ms.find(key));
+      std_ms.erase(std_ms.find(key));
+    }
+    ASSERT_EQ(ms.size(), std_ms.size());
+    ASSERT_EQ(ms.count(key), std_ms.count(key));
+  }
+  auto std_it = std_ms.begin();
+  for (auto it = ms.begin(); it != ms.end(); ++it, ++std_it) {
+    ASSERT_EQ(*it, *std_it);
+  }
+  auto std_rit = std_ms.rbegin();
+  for (auto rit = ms.rbegin(); rit != ms.rend(); ++rit, ++std_rit) {
+    ASSERT_EQ(*rit, *std_rit);
+  }
+  ASSERT_EQ(std_rit, std_ms.rend());
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_persistent_map.h"
+
+namespace {
+
+template <typename Map, typename StdMap>
+void ExpectSame(const Map &map, const StdMap &expected) {
+  ASSERT_EQ(map.size(), expected.size());
+  auto iter = map.begin();
+  for (auto &item : expected) {
+    ASSERT_EQ(iter->first, item.first);
+    ASSERT_EQ(iter->second, item.second);
+    ++iter;
+  }
+  ASSERT_EQ(iter, map.end());
+}
+
+// значение, копия которого бросает, когда запас копий исчерпан
+struct ThrowingValue {
+  static int copies_left;
+  int value;
+  ThrowingValue(int v = 0) : value(v) {}
+  ThrowingValue(const ThrowingValue &other) : value(other.value) {
+    if (--copies_left < 0) throw std::runtime_error("copy failed");
+  }
+  ThrowingValue &operator=(const ThrowingValue &) = default;
+};
+int ThrowingValue::copies_left = 1 << 30;
+
+std::map<int, int> Values(const s21::persistent_map<int, ThrowingValue> &map) {
+  std::map<int, int> values;
+  for (auto &item : map) values.emplace(item.first, item.second.value);
+  return values;
+}
+
+}  // namespace
+
+TEST(PersistentMap, MapInterface) {
+  s21::persistent_map<std::string, int> map{{"b", 2}, {"a", 1}};
+  EXPECT_EQ(map.size(), 2U);
+  EXPECT_EQ(map.at("a"), 1);
+  EXPECT_THROW(map.at("c"), std::out_of_range);
+  EXPECT_FALSE(map.insert("a", 10).second);
+  EXPECT_TRUE(map.insert(std::make_pair("c", 3)).second);
+  EXPECT_EQ(map.insert_or_assign("a", 11).first->second, 11);
+  EXPECT_TRUE(map.contains("c"));
+  EXPECT_EQ(map.find("d"), map.end());
+  EXPECT_EQ(map.find("b")->second, 2);
+  EXPECT_EQ(map.lower_bound("bb")->first, "c");
+  EXPECT_EQ(map.erase("b"), 1U);
+  EXPECT_EQ(map.erase("b"), 0U);
+  EXPECT_EQ(map.begin()->first, "a");
+
+  s21::persistent_map<std::string, int> other;
+  other.swap(map);
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(other.size(), 2U);
+  other.clear();
+  EXPECT_EQ(other.begin(), other.end());
+}
+
+// случайные записи в живую карту, снимки по ходу сверяются с копиями
+// std::map, сделанными в тот же момент
+TEST(PersistentMap, SnapshotsAgainstStdMap) {
+  std::mt19937 gen(43);
+  s21::persistent_map<int, int> map;
+  std::map<int, int> expected;
+  std::vector<s21::persistent_map<int, int>> snapshots;
+  std::vector<std::map<int, int>> expected_snapshots;
+  for (int i = 0; i < 20000; ++i) {
+    int key = gen() % 3000;
+    switch (gen() % 3) {
+      case 0:
+        ASSERT_EQ(map.insert(key, i).second, expected.insert({key, i}).second);
+        break;
+      case 1:
+        map.insert_or_assign(key, -i);
+        expected[key] = -i;
+        break;
+      default:
+        ASSERT_EQ(map.erase(key), expected.erase(key));
+    }
+    if (i % 2000 == 0) {
+      snapshots.push_back(map.snapshot());
+      expected_snapshots.push_back(expected);
+    }
+    if (i % 5000 == 4999) {
+      snapshots.erase(snapshots.begin());
+      expected_snapshots.erase(expected_snapshots.begin());
+    }
+  }
+  ExpectSame(map, expected);
+  for (size_t i = 0; i < snapshots.size(); ++i) {
+    ExpectSame(snapshots[i], expected_snapshots[i]);
+  }
+}
+
+// после снимка запись копирует только путь: все элементы, кроме O(log n),
+// у снимка и карты лежат в одних и тех же узлах
+TEST(PersistentMap, WritesCopyOnlyThePath) {
+  s21::persistent_map<int, int> map;
+  for (int key = 0; key < 100000; ++key) map.insert(key, key);
+  s21::persistent_map<int, int> snapshot = map.snapshot();
+  map.insert_or_assign(50000, -1);
+  map.erase(77777);
+  map.insert(100001, 1);
+
+  EXPECT_EQ(snapshot.at(50000), 50000);
+  EXPECT_TRUE(snapshot.contains(77777));
+  EXPECT_FALSE(snapshot.contains(100001));
+  EXPECT_EQ(map.at(50000), -1);
+
+  size_t copied = 0;
+  for (auto &item : map) {
+    auto pos = snapshot.find(item.first);
+    if (pos == snapshot.end() || &*pos != &item) ++copied;
+  }
+  EXPECT_LE(copied, 3U * 2 * 25);  // три пути по высоте AVL-дерева
+
+  // без снимков запись меняет узлы на месте
+  snapshot.clear();
+  const std::pair<const int, int> *address = &*map.find(123);
+  map.insert_or_assign(123, 7);
+  map.insert(-5, 0);
+  EXPECT_EQ(&*map.find(123), address);
+}
+
+// читатель обходит снимок в другом потоке, пока владелец пишет в карту
+TEST(PersistentMap, ReaderIteratesWhileWriterWrites) {
+  s21::persistent_map<int, long long> map;
+  for (int key = 0; key < 20000; ++key) map.insert(key, key);
+  std::atomic<bool> stop(false);
+  std::atomic<int> bad(0);
+
+  std::thread reader([snapshot = map.snapshot(), &stop, &bad] {
+    while (!stop.load()) {
+      long long sum = 0;
+      size_t count = 0;
+      for (auto &item : snapshot) {
+        sum += item.second;
+        ++count;
+      }
+      if (count != 20000 || sum != 19999LL * 20000 / 2) ++bad;
+    }
+  });
+  std::mt19937 gen(47);
+  for (int i = 0; i < 100000; ++i) {
+    int key = gen() % 40000;
+    if (gen() % 2 == 0) {
+      map.insert_or_assign(key, -1);
+    } else {
+      map.erase(key);
+    }
+    // новые снимки отдаются и освобождаются, пока старый читается
+    if (i % 1000 == 0) map.snapshot();
+  }
+  stop = true;
+  reader.join();
+  EXPECT_EQ(bad.load(), 0);
+}
+
+// Копия значения бросает на разной глубине пути, пока жив снимок: снимок не
+// меняется, карта содержит ключ или нет, и size() с этим согласован
+TEST(PersistentMap, ThrowingCopyKeepsSnapshot) {
+  using ThrowingMap = s21::persistent_map<int, ThrowingValue>;
+  ThrowingMap map;
+  std::map<int, int> expected;
+  for (int key = 0; key < 2000; key += 2) {
+    map.insert(key, ThrowingValue(key));
+    expected[key] = key;
+  }
+  for (int budget = 0; budget < 40; ++budget) {
+    ThrowingMap snapshot = map.snapshot();
+    std::map<int, int> expected_snapshot = expected;
+    int key = budget * 50 + 1;
+    ThrowingValue::copies_left = budget;
+    try {
+      if (budget % 2 == 0) {
+        map.insert(key, ThrowingValue(key));
+      } else {
+        map.erase(key - 1);
+      }
+    } catch (const std::runtime_error &) {
+    }
+    ThrowingValue::copies_left = 1 << 30;
+
+    if (map.contains(key)) expected[key] = key;
+    if (!map.contains(key - 1)) expected.erase(key - 1);
+    ASSERT_EQ(Values(snapshot), expected_snapshot);
+    ASSERT_EQ(Values(map), expected);
+    ASSERT_EQ(map.size(), expected.size());
+  }
+  // после исключений карта продолжает работать
+  for (int key = 0; key < 2000; ++key) map.insert_or_assign(key, key);
+  EXPECT_EQ(map.size(), 2000U);
+}
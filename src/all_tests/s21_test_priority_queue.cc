@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include "../s21_priority_queue.h"
+#include "functional"
+#include "queue"
+#include "random"
+#include "vector"
+
+TEST(PriorityQueueConstructor, DefaultConstructor) {
+  s21::PriorityQueue<int> que;
+  std::priority_queue<int> std_que;
+
+  EXPECT_EQ(que.size(), std_que.size());
+  EXPECT_EQ(que.empty(), std_que.empty());
+  EXPECT_EQ(que.size(), 0U);
+}
+
+TEST(PriorityQueueConstructor, InitializerListConstructor) {
+  std::vector<int> std_lst{3, 1, 4, 1, 5, 9, 2, 6};
+
+  s21::PriorityQueue<int> que{3, 1, 4, 1, 5, 9, 2, 6};
+  std::priority_queue<int> std_que(std_lst.begin(), std_lst.end());
+
+  EXPECT_EQ(que.size(), std_que.size());
+  while (!std_que.empty()) {
+    EXPECT_EQ(que.top(), std_que.top());
+    que.pop();
+    std_que.pop();
+  }
+  EXPECT_TRUE(que.empty());
+}
+
+TEST(PriorityQueueConstructor, RangeConstructor) {
+  std::vector<std::string> std_lst{"b", "d", "a", "c"};
+
+  s21::PriorityQueue<std::string> que(std_lst.begin(), std_lst.end());
+
+  EXPECT_EQ(que.size(), 4U);
+  EXPECT_EQ(que.top(), "d");
+}
+
+TEST(PriorityQueueConstructor, CopyConstructor) {
+  s21::PriorityQueue<int> original{5, 1, 3};
+  s21::PriorityQueue<int> copy(original);
+
+  copy.push(10);
+  EXPECT_EQ(original.size(), 3U);
+  EXPECT_EQ(original.top(), 5);
+  EXPECT_EQ(copy.size(), 4U);
+  EXPECT_EQ(copy.top(), 10);
+}
+
+TEST(PriorityQueueConstructor, MoveConstructor) {
+  s21::PriorityQueue<int> original{5, 1, 3};
+  s21::PriorityQueue<int> moved(std::move(original));
+
+  EXPECT_EQ(moved.size(), 3U);
+  EXPECT_EQ(moved.top(), 5);
+  EXPECT_EQ(original.size(), 0U);
+}
+
+TEST(PriorityQueueConstructor, Assignment) {
+  s21::PriorityQueue<int> original{5, 1, 3};
+  s21::PriorityQueue<int> copy;
+  s21::PriorityQueue<int> moved;
+
+  copy = original;
+  EXPECT_EQ(copy.top(), 5);
+  moved = std::move(original);
+  EXPECT_EQ(moved.size(), 3U);
+  EXPECT_EQ(moved.top(), 5);
+}
+
+TEST(PriorityQueueMethods, MinHeap) {
+  s21::PriorityQueue<int, s21::Vector<int>, std::greater<int>> que{7, 2, 9, 4};
+
+  EXPECT_EQ(que.top(), 2);
+  que.push(1);
+  EXPECT_EQ(que.top(), 1);
+  que.pop();
+  que.pop();
+  EXPECT_EQ(que.top(), 4);
+}
+
+TEST(PriorityQueueMethods, Emplace) {
+  s21::PriorityQueue<std::string> que;
+
+  que.emplace(3, 'a');
+  que.emplace("b");
+  EXPECT_EQ(que.top(), "b");
+  que.pop();
+  EXPECT_EQ(que.top(), "aaa");
+}
+
+TEST(PriorityQueueMethods, Swap) {
+  s21::PriorityQueue<int> que1{1, 2, 3};
+  s21::PriorityQueue<int> que2{10};
+
+  que1.swap(que2);
+  EXPECT_EQ(que1.size(), 1U);
+  EXPECT_EQ(que1.top(), 10);
+  EXPECT_EQ(que2.size(), 3U);
+  EXPECT_EQ(que2.top(), 3);
+}
+
+TEST(PriorityQueueMethods, StdVectorContainer) {
+  s21::PriorityQueue<int, std::vector<int>> que{4, 8, 1};
+
+  EXPECT_EQ(que.top(), 8);
+  que.pop();
+  EXPECT_EQ(que.top(), 4);
+}
+
+template <std::size_t Arity>
+void CheckRandomAgainstStd() {
+  std::mt19937 gen(Arity);
+  std::uniform_int_distribution<int> dist(-1000, 1000);
+  s21::PriorityQueue<int, s21::Vector<int>, std::less<int>, Arity> que;
+  std::priority_queue<int> std_que;
+
+  for (int i = 0; i < 2000; ++i) {
+    if (dist(gen) % 3 != 0 || std_que.empty()) {
+      int value = dist(gen);
+      que.push(value);
+      std_que.push(value);
+    } else {
+      que.pop();
+      std_que.pop();
+    }
+    ASSERT_EQ(que.size(), std_que.size());
+    if (!std_que.empty()) {
+      ASSERT_EQ(que.top(), std_que.top());
+    }
+  }
+}
+
+TEST(PriorityQueueMethods, RandomBinaryHeap) { CheckRandomAgainstStd<2>(); }
+
+TEST(PriorityQueueMethods, RandomQuaternaryHeap) { CheckRandomAgainstStd<4>(); }
+
+TEST(PriorityQueueMethods, RandomOctonaryHeap) { CheckRandomAgainstStd<8>(); }
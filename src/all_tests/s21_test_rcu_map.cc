@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_rcu_map.h"
+
+TEST(RcuMap, MapInterface) {
+  s21::rcu_map<std::string, int> map{{"b", 2}, {"a", 1}};
+  EXPECT_EQ(map.size(), 2U);
+  EXPECT_TRUE(map.contains("a"));
+  EXPECT_FALSE(map.contains("c"));
+
+  int value = 0;
+  EXPECT_TRUE(map.find("b", value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(map.find("c", value));
+  EXPECT_EQ(value, 2);
+
+  EXPECT_TRUE(map.insert("c", 3));
+  EXPECT_FALSE(map.insert("c", 4));
+  EXPECT_FALSE(map.insert_or_assign("c", 5));
+  EXPECT_TRUE(map.find("c", value));
+  EXPECT_EQ(value, 5);
+  EXPECT_EQ(map.erase("a"), 1U);
+  EXPECT_EQ(map.erase("a"), 0U);
+
+  auto snapshot = map.snapshot();
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(snapshot.size(), 2U);
+  EXPECT_EQ(snapshot.at("c"), 5);
+}
+
+TEST(RcuMap, UpdateIsPublishedAtOnce) {
+  s21::rcu_map<int, int> map;
+  size_t size = map.update([](s21::rcu_map<int, int>::version_type &next) {
+    for (int key = 0; key < 100; ++key) next.insert(key, key);
+    return next.size();
+  });
+  EXPECT_EQ(size, 100U);
+  int sum = map.read([](const s21::rcu_map<int, int>::version_type &current) {
+    int total = 0;
+    for (auto &item : current) total += item.second;
+    return total;
+  });
+  EXPECT_EQ(sum, 4950);
+}
+
+namespace {
+
+// значение, копия которого бросает, когда запас копий исчерпан
+struct ThrowingValue {
+  static int copies_left;
+  int value;
+  ThrowingValue(int v = 0) : value(v) {}
+  ThrowingValue(const ThrowingValue &other) : value(other.value) {
+    if (--copies_left < 0) throw std::runtime_error("copy failed");
+  }
+  ThrowingValue &operator=(const ThrowingValue &) = default;
+};
+int ThrowingValue::copies_left = 1 << 30;
+
+}  // namespace
+
+TEST(RcuMap, ThrowingUpdateIsNotPublished) {
+  s21::rcu_map<int, int> map{{1, 1}};
+  EXPECT_THROW(map.update([](s21::rcu_map<int, int>::version_type &next) {
+    next.insert(2, 2);
+    throw std::runtime_error("update failed");
+  }),
+               std::runtime_error);
+  EXPECT_EQ(map.size(), 1U);
+  EXPECT_FALSE(map.contains(2));
+}
+
+// копия значения бросает посреди пути копирования: опубликованная версия
+// остается целой и прежней
+TEST(RcuMap, ThrowingCopyInsideUpdateIsNotPublished) {
+  using ThrowingMap = s21::rcu_map<int, ThrowingValue>;
+  ThrowingMap map;
+  map.update([](ThrowingMap::version_type &next) {
+    for (int key = 0; key < 200; key += 2) next.insert(key, key);
+  });
+  int sum = 9900;
+  size_t size = 100;
+  for (int budget = 0; budget < 20; ++budget) {
+    ThrowingValue::copies_left = budget;
+    try {
+      if (budget % 2 == 0) {
+        map.insert(budget * 10 + 1, ThrowingValue(1));
+        sum += 1;
+        ++size;
+      } else {
+        map.erase(budget * 10);
+        sum -= budget * 10;
+        --size;
+      }
+    } catch (const std::runtime_error &) {
+    }
+    ThrowingValue::copies_left = 1 << 30;
+    int published = map.read([](const ThrowingMap::version_type &current) {
+      int total = 0;
+      for (auto &item : current) total += item.second.value;
+      return total;
+    });
+    EXPECT_EQ(published, sum);
+    EXPECT_EQ(map.size(), size);
+  }
+}
+
+// Писатель переводит сумму между счетами одним update(); читатели без
+// блокировок никогда не видят полупримененный перевод
+TEST(RcuMap, ReadersSeeWholeVersions) {
+  const int kAccounts = 64;
+  const long long kTotal = kAccounts * 1000LL;
+  s21::rcu_map<int, long long> map;
+  map.update([&](s21::rcu_map<int, long long>::version_type &next) {
+    for (int key = 0; key < kAccounts; ++key) next.insert(key, 1000);
+  });
+
+  std::atomic<bool> stop(false);
+  std::atomic<int> bad(0);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; ++t) {
+    readers.emplace_back([&map, &stop, &bad, t] {
+      std::mt19937 gen(t);
+      while (!stop.load()) {
+        long long sum = map.read(
+            [](const s21::rcu_map<int, long long>::version_type &current) {
+              long long total = 0;
+              for (auto &item : current) total += item.second;
+              return total;
+            });
+        if (sum != kTotal) ++bad;
+        long long value = 0;
+        if (!map.find(static_cast<int>(gen() % kAccounts), value)) ++bad;
+      }
+    });
+  }
+
+  std::mt19937 gen(48);
+  for (int i = 0; i < 5000; ++i) {
+    int from = gen() % kAccounts;
+    int to = gen() % kAccounts;
+    long long amount = gen() % 100;
+    map.update([&](s21::rcu_map<int, long long>::version_type &next) {
+      long long from_value = next.at(from);
+      next.insert_or_assign(from, from_value - amount);
+      next.insert_or_assign(to, next.at(to) + amount);
+    });
+  }
+  stop = true;
+  for (auto &reader : readers) reader.join();
+  EXPECT_EQ(bad.load(), 0);
+  EXPECT_EQ(map.size(), static_cast<size_t>(kAccounts));
+}
+
+// int main(int argc, char **argv) {
+//   testing::InitGoogleTest(&argc, argv);
+//   return RUN_ALL_TESTS();
+// }
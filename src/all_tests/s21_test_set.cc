@@ -1,7 +1,13 @@
 #include <gtest/gtest.h>
 
 #include "../s21_set.h"
+#include <algorithm>
+#include <iterator>
+#include <random>
+
 #include "set"
+#include "string"
+#include "vector"
 
 #define s21_EPS 1e-7
 
@@ -14,7 +20,8 @@ TEST(Set, DefaultConstructor) {
 TEST(Set, InitializerListConstructor) {
   s21::set<std::string> s21set{"one", "two", "three"};
   EXPECT_EQ(s21set.size(), 3);
-  EXPECT_EQ(s21set.GetTree().GetRoot()->key, "one");
+  // после балансировки корнем становится средний ключ
+  EXPECT_EQ(s21set.GetTree().GetRoot()->GetKey(), "three");
 }
 
 TEST(Set, CopyConstructor) {
@@ -49,7 +56,7 @@ TEST(Set, Size_Empty) {
 
   EXPECT_TRUE(empty_set.empty());
   EXPECT_EQ(empty_set.size(), 0);
-  // std::cout << set33.GetTree().GetRoot()->key << std::endl;
+  // std::cout << set33.GetTree().GetRoot()->GetKey() << std::endl;
   EXPECT_FALSE(set33.empty());
   EXPECT_EQ(set33.size(), 3);
 }
@@ -78,8 +85,8 @@ TEST(Set, InsertPair1) {
 
   EXPECT_EQ(set14.insert(3).second, set24.insert(3).second);
   EXPECT_EQ(set14.size(), set24.size());
-  EXPECT_EQ(set14.GetTree().GetRoot()->key, 3);
-  EXPECT_EQ(set24.GetTree().GetRoot()->key, 3);
+  EXPECT_EQ(set14.GetTree().GetRoot()->GetKey(), 3);
+  EXPECT_EQ(set24.GetTree().GetRoot()->GetKey(), 3);
 }
 
 TEST(Set, Erase_and_Begin) {
@@ -91,14 +98,15 @@ TEST(Set, Erase_and_Begin) {
   EXPECT_EQ(m1.size(), 4);
 
   auto iter = m1.begin();
-  EXPECT_EQ(iter.node_->key, "два");
+  EXPECT_EQ(*iter, "два");
 
-  auto iter2 = m1.end();
-  EXPECT_EQ(iter2.node_->key, "один");
+  auto iter2 = --m1.end();
+  EXPECT_EQ(*iter2, "один");
+  EXPECT_EQ(++iter2, m1.end());
 
   m1.erase(iter);
   EXPECT_EQ(m1.size(), 3);
-  EXPECT_EQ(m1.begin().node_->key, "двенадцать");
+  EXPECT_EQ(*m1.begin(), "двенадцать");
 }
 
 TEST(Set, Swap) {
@@ -140,6 +148,235 @@ TEST(Set, Contains) {
   EXPECT_FALSE(set.contains("tree"));
 }
 
+TEST(Set, Bounds) {
+  s21::set<int> set = {10, 20, 30};
+
+  EXPECT_EQ(*set.lower_bound(20), 20);
+  EXPECT_EQ(*set.upper_bound(20), 30);
+  EXPECT_EQ(*set.lower_bound(11), 20);
+  EXPECT_EQ(set.upper_bound(30), set.end());
+
+  auto range = set.equal_range(10);
+  EXPECT_EQ(*range.first, 10);
+  EXPECT_EQ(*range.second, 20);
+}
+
+TEST(Set, Range) {
+  s21::set<int> set;
+  for (int key = 0; key < 100; ++key) set.insert(key);
+
+  int sum = 0;
+  for (int key : set.range(10, 20)) sum += key;
+  EXPECT_EQ(sum, 145);
+  EXPECT_TRUE(set.range(50, 50).empty());
+  EXPECT_EQ(*set.range(95, 1000).begin(), 95);
+}
+
+// begin() и rbegin() берутся из заголовка дерева и остаются верными
+// после удаления крайних элементов
+TEST(Set, BeginEndAfterErase) {
+  s21::set<int> set{5, 1, 9, 3, 7};
+  EXPECT_EQ(*set.begin(), 1);
+  EXPECT_EQ(*set.rbegin(), 9);
+
+  set.erase(set.begin());
+  set.erase(--set.end());
+  EXPECT_EQ(*set.begin(), 3);
+  EXPECT_EQ(*set.rbegin(), 7);
+
+  int expected = 7;
+  for (auto iter = set.rbegin(); iter != set.rend(); ++iter, expected -= 2) {
+    EXPECT_EQ(*iter, expected);
+  }
+  EXPECT_EQ(expected, 1);
+
+  set.clear();
+  EXPECT_EQ(set.begin(), set.end());
+  EXPECT_EQ(set.rbegin(), set.rend());
+}
+
+TEST(Set, BulkConstruction) {
+  std::vector<std::string> words = {"pear", "apple", "fig", "apple", "kiwi"};
+  s21::set<std::string> set(words.begin(), words.end());
+  EXPECT_EQ(set.size(), 4U);
+  EXPECT_EQ(*set.begin(), "apple");
+  EXPECT_EQ(*set.rbegin(), "pear");
+
+  std::set<std::string> sorted(words.begin(), words.end());
+  set.assign_sorted(sorted.rbegin(), sorted.rbegin());
+  EXPECT_TRUE(set.empty());
+  set.assign_sorted(sorted.begin(), sorted.end());
+  EXPECT_EQ(set.size(), 4U);
+  EXPECT_TRUE(set.contains("fig"));
+  EXPECT_FALSE(set.insert("kiwi").second);
+}
+
+// операции над множествами сверяются с std::set_* на случайных данных,
+// в том числе когда одно множество намного меньше другого
+TEST(Set, SetAlgebraRandom) {
+  std::mt19937 gen(12);
+  for (size_t small : {0, 3, 40, 700}) {
+    std::set<int> std_a, std_b;
+    for (size_t i = 0; i < small; ++i) std_a.insert(gen() % 2000);
+    for (int i = 0; i < 700; ++i) std_b.insert(gen() % 2000);
+    s21::set<int> a(std_a.begin(), std_a.end());
+    s21::set<int> b(std_b.begin(), std_b.end());
+
+    std::vector<int> expected;
+    std::set_union(std_a.begin(), std_a.end(), std_b.begin(), std_b.end(),
+                   std::back_inserter(expected));
+    s21::set<int> united = set_union(a, b);
+    ASSERT_TRUE(std::equal(united.begin(), united.end(), expected.begin(),
+                           expected.end()));
+
+    for (int swap = 0; swap < 2; ++swap) {
+      std::set<int> &x = swap ? std_b : std_a;
+      std::set<int> &y = swap ? std_a : std_b;
+      s21::set<int> result = swap ? set_intersection(b, a)
+                                  : set_intersection(a, b);
+      expected.clear();
+      std::set_intersection(x.begin(), x.end(), y.begin(), y.end(),
+                            std::back_inserter(expected));
+      ASSERT_TRUE(std::equal(result.begin(), result.end(), expected.begin(),
+                             expected.end()));
+
+      result = swap ? set_difference(b, a) : set_difference(a, b);
+      expected.clear();
+      std::set_difference(x.begin(), x.end(), y.begin(), y.end(),
+                          std::back_inserter(expected));
+      ASSERT_TRUE(std::equal(result.begin(), result.end(), expected.begin(),
+                             expected.end()));
+      ASSERT_EQ(result.size(), expected.size());
+    }
+  }
+}
+
+TEST(Set, MergeMovesNodes) {
+  s21::set<int> set{1, 5, 9};
+  s21::set<int> other{2, 5, 7};
+  const int *seven = &*other.find(7);
+  set.merge(other);
+  EXPECT_EQ(set.size(), 5U);
+  EXPECT_EQ(&*set.find(7), seven);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(*other.begin(), 5);
+
+  s21::set<int> copy;
+  copy = set;
+  copy.insert(100);
+  EXPECT_EQ(set.size(), 5U);
+  EXPECT_EQ(copy.size(), 6U);
+}
+
+TEST(Set, OrderStatistics) {
+  s21::set<int, true> set;
+  for (int key = 0; key < 1000; ++key) set.insert((key * 7) % 1000);
+  set.erase(set.find(500));
+
+  EXPECT_EQ(set.size(), 999U);
+  EXPECT_EQ(*set.nth(0), 0);
+  EXPECT_EQ(*set.nth(499), 499);
+  EXPECT_EQ(*set.nth(500), 501);
+  EXPECT_EQ(set.nth(999), set.end());
+  EXPECT_EQ(set.rank(0), 0U);
+  EXPECT_EQ(set.rank(500), 500U);
+  EXPECT_EQ(set.rank(501), 500U);
+  EXPECT_EQ(set.rank(5000), 999U);
+  // 90-й перцентиль
+  EXPECT_EQ(*set.nth(set.size() * 9 / 10), 900);
+
+  EXPECT_EQ(set.distance(set.begin(), set.end()), set.size());
+  EXPECT_EQ(set.distance(set.lower_bound(100), set.lower_bound(200)), 100U);
+  EXPECT_EQ(set.distance(set.find(499), set.find(501)), 1U);
+}
+
+TEST(Set, ExtractAndInsertNode) {
+  s21::set<int> set = {1, 2, 3};
+  s21::set<int> other = {3};
+  const int *address = &*set.find(2);
+
+  auto node = set.extract(set.find(2));
+  EXPECT_EQ(node.key(), 2);
+  EXPECT_EQ(set.size(), 2U);
+  node.key() = 7;
+  auto result = set.insert(std::move(node));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ(&*result.position, address);
+  EXPECT_EQ(*--set.end(), 7);
+
+  result = other.insert(set.extract(3));
+  EXPECT_FALSE(result.inserted);
+  EXPECT_EQ(result.node.key(), 3);
+  EXPECT_EQ(set.size(), 2U);
+  result = set.insert(std::move(result.node));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ(set.size(), 3U);
+  EXPECT_TRUE(set.extract(42).empty());
+}
+
+TEST(Set, SplitJoinAgainstNaive) {
+  std::mt19937 gen(29);
+  for (int round = 0; round < 100; ++round) {
+    std::vector<int> keys;
+    for (int i = 0; i < round * 20; ++i) keys.push_back(gen() % 4000);
+    s21::set<int> set(keys.begin(), keys.end());
+    std::set<int> naive(keys.begin(), keys.end());
+    int cut = gen() % 4000;
+
+    s21::set<int> greater = set.split(cut);
+    std::set<int> naive_greater;
+    for (auto iter = naive.begin(); iter != naive.end();) {
+      if (*iter >= cut) {
+        naive_greater.insert(*iter);
+        iter = naive.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+    ASSERT_EQ(std::vector<int>(set.begin(), set.end()),
+              std::vector<int>(naive.begin(), naive.end()));
+    ASSERT_EQ(std::vector<int>(greater.begin(), greater.end()),
+              std::vector<int>(naive_greater.begin(), naive_greater.end()));
+    ASSERT_EQ(set.size(), naive.size());
+    ASSERT_EQ(greater.size(), naive_greater.size());
+
+    greater.join(set);
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(greater.size(), naive.size() + naive_greater.size());
+    if (!greater.empty()) {
+      s21::set<int> copy(greater);
+      EXPECT_THROW(greater.join(copy), std::invalid_argument);
+    }
+  }
+}
+
+TEST(Set, EraseKeyRangeAndIf) {
+  s21::set<int> set;
+  for (int key = 0; key < 100; ++key) set.insert(key);
+  EXPECT_EQ(set.erase(50), 1U);
+  EXPECT_EQ(set.erase(50), 0U);
+  EXPECT_EQ(*set.erase(set.find(10)), 11);
+  auto last = set.erase(set.find(20), set.find(40));
+  EXPECT_EQ(*last, 40);
+  EXPECT_EQ(set.size(), 78U);
+  EXPECT_EQ(erase_if(set, [](int key) { return key % 2 == 0; }), 38U);
+  EXPECT_EQ(set.size(), 40U);
+  EXPECT_EQ(*set.begin(), 1);
+  EXPECT_EQ(*--set.end(), 99);
+  EXPECT_EQ(set.erase(set.begin(), set.end()), set.end());
+  EXPECT_TRUE(set.empty());
+}
+
+TEST(Set, HintedInsert) {
+  s21::set<int> set;
+  for (int key = 100; key > 0; --key) set.insert(set.begin(), key);
+  for (int key = 100; key <= 200; ++key) set.insert(set.end(), key);
+  EXPECT_EQ(*set.insert(set.find(50), 50), 50);
+  EXPECT_EQ(set.size(), 200U);
+  int expected = 1;
+  for (int key : set) EXPECT_EQ(key, expected++);
+}
+
 // int main(int argc, char **argv) {
 //   testing::InitGoogleTest(&argc, argv);
 //   return RUN_ALL_TESTS();
@@ -1,18 +1,77 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iostream>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 #include "../tree.h"
 
 // проверка конструктора для узла Node c передаваемым значением ключа
 TEST(Tree, Node_constructor) {
-  s21::Node<int, int> node(25);
-  ASSERT_EQ(node.key, 25);
+  s21::Node<int> node(25);
+  ASSERT_EQ(node.GetKey(), 25);
+}
+
+// у множества (V = void) в узле лежит только ключ, итератор отдает const ключ
+static_assert(sizeof(s21::Node<std::string>) <
+                  sizeof(s21::Node<std::string, std::string>),
+              "a key-only node has no room for a mapped value");
+static_assert(std::is_same_v<decltype(*s21::Iterator<int>(nullptr, nullptr)),
+                             const int &>,
+              "set iterators must not allow changing the key");
+
+// узел - это значение и три указателя: цвет спрятан в младшем бите top,
+// флагов минимума и максимума нет
+static_assert(sizeof(s21::Node<int, int>) ==
+                  sizeof(std::pair<const int, int>) + 3 * sizeof(void *),
+              "node header must be exactly three pointers");
+
+// цвет и родитель меняются независимо друг от друга
+TEST(Tree, Node_packed_top) {
+  s21::Node<int> parent(1);
+  s21::Node<int> node(2);
+  ASSERT_TRUE(node.IsRed());
+  ASSERT_EQ(node.GetTop(), nullptr);
+  node.SetTop(&parent);
+  ASSERT_TRUE(node.IsRed());
+  node.SetRed(false);
+  ASSERT_EQ(node.GetTop(), &parent);
+  ASSERT_FALSE(node.IsRed());
+  node.SetTop(nullptr);
+  ASSERT_FALSE(node.IsRed());
+  node.SetRed(true);
+  ASSERT_EQ(node.GetTop(), nullptr);
+}
+
+// у словаря ключ и значение лежат в узле одной парой, итератор отдает ее
+TEST(Tree, Node_pair_layout) {
+  s21::Tree<int, std::string> tree;
+  EXPECT_TRUE(tree.InsertUnique(7, "seven").second);
+  EXPECT_TRUE(tree.InsertUnique(3).second);
+  s21::Iterator<int, std::string> iter(tree.Search(7), tree.GetHeader());
+  std::pair<const int, std::string> &item = *iter;
+  EXPECT_EQ(item.first, 7);
+  EXPECT_EQ(iter->second, "seven");
+  iter->second = "VII";
+  EXPECT_EQ(tree.Search(7)->value.second, "VII");
+  EXPECT_EQ(tree.Search(3)->value.second, "");
+
+  // повторный ключ не создает узел и не трогает значение
+  EXPECT_FALSE(tree.InsertUnique(7, "again").second);
+  EXPECT_EQ(tree.Search(7)->value.second, "VII");
+
+  s21::Tree<int, std::string> copy(tree);
+  EXPECT_EQ(copy.Search(7)->value.second, "VII");
 }
 // проверка конструктора инициализирующего пустое дерево
 TEST(Tree, Tree_constructor) {
-  s21::Tree<int, int> tree = s21::Tree<int, int>();
+  s21::Tree<int> tree = s21::Tree<int>();
   ASSERT_EQ(tree.GetRoot(), nullptr);
   ASSERT_EQ(tree.GetMax(), 0);
   ASSERT_EQ(tree.GetMin(), 0);
@@ -21,21 +80,21 @@ TEST(Tree, Tree_constructor) {
 
 // провека как вставляется узел в дерево и как дерево удаляется
 TEST(Tree, Tree_InsertNodeAndClearTree) {
-  s21::Tree<int, int> tree = s21::Tree<int, int>();  // создаем пустое дерево
+  s21::Tree<int> tree = s21::Tree<int>();  // создаем пустое дерево
   ASSERT_EQ(tree.GetRoot(), nullptr);
 
-  s21::Node<int, int> *node = tree.Insert(12);  // узел станет корнем дерева
-  ASSERT_EQ(node->key, 12);
+  s21::Node<int> *node = tree.Insert(12);  // узел станет корнем дерева
+  ASSERT_EQ(node->GetKey(), 12);
   ASSERT_EQ(tree.GetRoot(), node);
 
   tree.Insert(2);  // пойдет в левую часть
-  ASSERT_EQ(tree.GetRoot()->left->key, 2);
+  ASSERT_EQ(tree.GetRoot()->left->GetKey(), 2);
 
   tree.Insert(16);  // пойдет в правую часть
-  ASSERT_EQ(tree.GetRoot()->right->key, 16);
+  ASSERT_EQ(tree.GetRoot()->right->GetKey(), 16);
 
   tree.Insert(13);  // пойдет правую, потом в левую часть
-  ASSERT_EQ(tree.GetRoot()->right->left->key, 13);
+  ASSERT_EQ(tree.GetRoot()->right->left->GetKey(), 13);
 
   tree.ClearTree(tree.GetRoot());
   ASSERT_EQ(tree.GetRoot(), nullptr);
@@ -44,18 +103,18 @@ TEST(Tree, Tree_InsertNodeAndClearTree) {
 // ПРоверка конструктора для дерева
 TEST(Tree, CopyConstructorTree) {
   // создаем пустое дерево и заносим туда узлы с различными ключами
-  s21::Tree<int, int> tree = s21::Tree<int, int>();  // создаем пустое дерево
+  s21::Tree<int> tree = s21::Tree<int>();  // создаем пустое дерево
   tree.Insert(12);  // узел станет корнем дерева
   tree.Insert(2);   // пойдет в левую часть
   tree.Insert(16);  // пойдет в правую часть
   tree.Insert(13);  // пойдет правую, потом в левую часть
 
   // СОздаем другое с использованием конструктора копирования
-  s21::Tree<int, int> copyTree(tree);
+  s21::Tree<int> copyTree(tree);
 
-  ASSERT_EQ(tree.GetRoot()->key, copyTree.GetRoot()->key);
-  ASSERT_EQ(tree.GetRoot()->right->left->key,
-            copyTree.GetRoot()->right->left->key);
+  ASSERT_EQ(tree.GetRoot()->GetKey(), copyTree.GetRoot()->GetKey());
+  ASSERT_EQ(tree.GetRoot()->right->left->GetKey(),
+            copyTree.GetRoot()->right->left->GetKey());
 
   ASSERT_EQ(tree.GetMax(), copyTree.GetMax());
   ASSERT_EQ(tree.GetMin(), copyTree.GetMin());
@@ -65,33 +124,33 @@ TEST(Tree, CopyConstructorTree) {
 // ПРоверка оператора присваивания переносом
 TEST(Tree, OperatorTree) {
   // создаем пустое дерево и заносим туда узлы с различными ключами
-  s21::Tree<int, int> tree = s21::Tree<int, int>();  // создаем пустое дерево
+  s21::Tree<int> tree = s21::Tree<int>();  // создаем пустое дерево
   tree.Insert(12);  // узел станет корнем дерева
   tree.Insert(2);   // пойдет в левую часть
   tree.Insert(16);  // пойдет в правую часть
   tree.Insert(13);  // пойдет правую, потом в левую часть
 
   // Используем перезагруженный оператор
-  s21::Tree<int, int> moveTree = tree;
+  s21::Tree<int> moveTree = tree;
 
-  ASSERT_EQ(tree.GetRoot()->key, moveTree.GetRoot()->key);
-  ASSERT_EQ(tree.GetRoot()->right->left->key,
-            moveTree.GetRoot()->right->left->key);
+  ASSERT_EQ(tree.GetRoot()->GetKey(), moveTree.GetRoot()->GetKey());
+  ASSERT_EQ(tree.GetRoot()->right->left->GetKey(),
+            moveTree.GetRoot()->right->left->GetKey());
 }
 
 // ПРоверка конструктора итератора
 TEST(Tree, IteratorConstructor) {
   // создаем пустое дерево и заносим туда узлы с различными ключами
-  s21::Tree<int, int> tree = s21::Tree<int, int>();  // создаем пустое дерево
+  s21::Tree<int> tree = s21::Tree<int>();  // создаем пустое дерево
   tree.Insert(12);  // узел станет корнем дерева
   tree.Insert(2);   // пойдет в левую часть
   tree.Insert(16);  // пойдет в правую часть
   tree.Insert(13);  // пойдет правую, потом в левую часть
 
   // создаем иттератор через исследуемый конструктор
-  s21::Iterator<int, int> iter(tree.GetRoot()->left, tree.GetRoot());
+  s21::Iterator<int> iter(tree.GetRoot()->left, tree.GetHeader());
 
-  ASSERT_EQ(tree.GetRoot(), iter.root_);
+  ASSERT_EQ(tree.GetHeader(), iter.header_);
   ASSERT_EQ(tree.GetRoot()->left, iter.node_);
 
   ASSERT_EQ(*iter, 2);
@@ -100,7 +159,7 @@ TEST(Tree, IteratorConstructor) {
 // ПРоверка перезагруженных операторов итератора (*, ++, --, ==, !=)
 TEST(Tree, IteratorOperator) {
   // создаем пустое дерево и заносим туда узлы с различными ключами
-  s21::Tree<int, int> tree = s21::Tree<int, int>();  // создаем пустое дерево
+  s21::Tree<int> tree = s21::Tree<int>();  // создаем пустое дерево
   tree.Insert(12);  // узел станет корнем дерева
   tree.Insert(2);   // пойдет в левую часть
   tree.Insert(16);  // пойдет в правую часть
@@ -108,9 +167,9 @@ TEST(Tree, IteratorOperator) {
   tree.Insert(0);
 
   // создаем иттератор c помощью нашего конструктора
-  s21::Iterator<int, int> iter(tree.GetRoot()->left, tree.GetRoot());
-  s21::Iterator<int, int> iter1(iter.node_,
-                                tree.GetRoot());  // для проверки '==' и '!='
+  s21::Iterator<int> iter(tree.GetRoot()->left, tree.GetHeader());
+  s21::Iterator<int> iter1(iter.node_,
+                           tree.GetHeader());  // для проверки '==' и '!='
   ASSERT_EQ(*iter, 2);
 
   ++iter;  // 12
@@ -118,10 +177,13 @@ TEST(Tree, IteratorOperator) {
 
   ASSERT_EQ(iter != iter1, true);  // 13 != 2
   iter++;                          // 16
-  iter++;                          // 16
-  iter++;                          // 16
-  --iter;                          // 13
+  iter++;                          // end
+  ASSERT_EQ(iter.node_, nullptr);
+  iter++;  // end
+  --iter;  // 16
+  ASSERT_EQ(*iter, 16);
 
+  iter--;  // 13
   iter--;  // 12
   iter--;  // 2
   iter--;  // 0
@@ -134,33 +196,576 @@ TEST(Tree, IteratorOperator) {
 
 TEST(Tree, Search) {
   // создаем пустое дерево и заносим туда узлы с различными ключами
-  s21::Tree<int, int> tree = s21::Tree<int, int>();  // создаем пустое дерево
+  s21::Tree<int> tree = s21::Tree<int>();  // создаем пустое дерево
   tree.Insert(12);  // узел станет корнем дерева
   tree.Insert(2);   // пойдет в левую часть
   tree.Insert(16);  // пойдет в правую часть
   tree.Insert(13);  // пойдет правую, потом в левую часть
 
-  // tree.Search(2)->key ;
-  ASSERT_EQ(tree.Search(2)->key, 2);
+  // tree.Search(2)->GetKey() ;
+  ASSERT_EQ(tree.Search(2)->GetKey(), 2);
   // ASSERT_EQ(*iter, 2);
 }
 
 TEST(Tree, Remove) {
   // создаем пустое дерево и заносим туда узлы с различными ключами
-  s21::Tree<int, int> tree = s21::Tree<int, int>();  // создаем пустое дерево
+  s21::Tree<int> tree = s21::Tree<int>();  // создаем пустое дерево
   tree.Insert(12);  // узел станет корнем дерева
   tree.Insert(2);   // пойдет в левую часть
   tree.Insert(16);  // пойдет в правую часть
   tree.Insert(13);  // пойдет правую, потом в левую часть
 
   tree.Remove(12);
-  ASSERT_EQ(tree.GetRoot()->key, 13);
+  ASSERT_EQ(tree.GetRoot()->GetKey(), 13);
   ASSERT_EQ(tree.GetSize(), 3);
 
   tree.Remove(2);
   ASSERT_EQ(tree.GetSize(), 2);
 }
 
+// повторная вставка того же ключа не меняет размер дерева
+TEST(Tree, InsertDuplicate) {
+  s21::Tree<int> tree;
+  tree.Insert(5);
+  tree.Insert(5);
+  ASSERT_EQ(tree.GetSize(), 1);
+
+  auto res = tree.InsertUnique(5);
+  ASSERT_FALSE(res.second);
+  ASSERT_EQ(res.first, tree.GetRoot());
+}
+
+// InsertMulti кладет равные ключи в отдельные узлы, правее уже имеющихся
+TEST(Tree, InsertMultiAndBounds) {
+  s21::Tree<int> tree;
+  tree.InsertMulti(10);
+  s21::Node<int> *second = tree.InsertMulti(10);
+  tree.InsertMulti(5);
+  tree.InsertMulti(15);
+  ASSERT_EQ(tree.GetSize(), 4);
+  ASSERT_EQ(tree.GetRoot()->right, second);
+  ASSERT_EQ(second->GetTop(), tree.GetRoot());
+
+  ASSERT_EQ(tree.LowerBound(10), tree.GetRoot());
+  ASSERT_EQ(tree.UpperBound(10)->GetKey(), 15);
+  ASSERT_EQ(tree.LowerBound(11)->GetKey(), 15);
+  ASSERT_EQ(tree.UpperBound(15), nullptr);
+  ASSERT_EQ(tree.LowerBound(0)->GetKey(), 5);
+}
+
+// после удаления узла с двумя потомками родители и флаги краев верные
+TEST(Tree, RemoveNodeKeepsLinks) {
+  s21::Tree<int> tree;
+  for (int key : {50, 30, 70, 20, 40, 60, 80, 65}) tree.Insert(key);
+
+  tree.Remove(50);  // на место корня встает 60
+  s21::Node<int> *root = tree.GetRoot();
+  ASSERT_EQ(root->GetKey(), 60);
+  ASSERT_EQ(root->GetTop(), nullptr);
+  ASSERT_EQ(root->left->GetTop(), root);
+  ASSERT_EQ(root->right->GetTop(), root);
+  ASSERT_EQ(root->right->left->GetKey(), 65);
+  ASSERT_EQ(root->right->left->GetTop(), root->right);
+
+  tree.Remove(80);  // максимальный
+  tree.Remove(20);  // минимальный
+  ASSERT_EQ(tree.GetMax(), 70);
+  ASSERT_EQ(tree.GetMin(), 30);
+  ASSERT_EQ(tree.GetSize(), 5);
+
+  s21::Iterator<int> iter(tree.Search(30), tree.GetHeader());
+  int expected[] = {30, 40, 60, 65, 70};
+  for (int key : expected) {
+    ASSERT_EQ(*iter, key);
+    ++iter;
+  }
+  ASSERT_EQ(tree.GetLast(), tree.Search(70));
+  ASSERT_EQ(tree.GetFirst(), tree.Search(30));
+}
+
+// проверка свойств красно-черного дерева, возвращает черную высоту
+int CheckRedBlack(s21::Node<int> *node, s21::Node<int> *parent) {
+  if (node == nullptr) return 1;
+  EXPECT_EQ(node->GetTop(), parent);
+  if (node->IsRed()) {
+    EXPECT_FALSE(node->left != nullptr && node->left->IsRed());
+    EXPECT_FALSE(node->right != nullptr && node->right->IsRed());
+  }
+  if (node->left != nullptr) {
+    EXPECT_FALSE(node->GetKey() < node->left->GetKey());
+  }
+  if (node->right != nullptr) {
+    EXPECT_FALSE(node->right->GetKey() < node->GetKey());
+  }
+  int left = CheckRedBlack(node->left, node);
+  int right = CheckRedBlack(node->right, node);
+  EXPECT_EQ(left, right);
+  return left + (node->IsRed() ? 0 : 1);
+}
+
+// вставка по возрастанию не вырождает дерево в список
+TEST(Tree, BalancedOnSortedInsert) {
+  s21::Tree<int> tree;
+  for (int key = 0; key < 1023; ++key) tree.Insert(key);
+
+  ASSERT_EQ(tree.GetSize(), 1023);
+  ASSERT_FALSE(tree.GetRoot()->IsRed());
+  int black_height = CheckRedBlack(tree.GetRoot(), nullptr);
+  ASSERT_LE(black_height, 11);
+  int depth = 0;
+  for (s21::Node<int> *node = tree.Search(1022); node != nullptr;
+       node = node->GetTop()) {
+    ++depth;
+  }
+  ASSERT_LE(depth, 20);
+}
+
+// случайные вставки и удаления сохраняют свойства красно-черного дерева
+TEST(Tree, RedBlackRandomInsertRemove) {
+  std::mt19937 gen(5);
+  s21::Tree<int> tree;
+  std::set<int> keys;
+
+  for (int i = 0; i < 3000; ++i) {
+    int key = gen() % 500;
+    if (gen() % 2 == 0) {
+      tree.Insert(key);
+      keys.insert(key);
+    } else {
+      tree.Remove(key);
+      keys.erase(key);
+    }
+    ASSERT_EQ(tree.GetSize(), keys.size());
+  }
+  CheckRedBlack(tree.GetRoot(), nullptr);
+  if (!keys.empty()) {
+    ASSERT_EQ(tree.GetMin(), *keys.begin());
+    ASSERT_EQ(tree.GetMax(), *keys.rbegin());
+  }
+  s21::Iterator<int> iter(tree.LowerBound(0), tree.GetHeader());
+  for (int key : keys) {
+    ASSERT_EQ(*iter, key);
+    ++iter;
+  }
+  ASSERT_EQ(iter.node_, nullptr);
+}
+
+// без Counted узел не хранит размер поддерева и не становится больше
+static_assert(sizeof(s21::Node<int>) < sizeof(s21::Node<int, void, true>),
+              "only the counted node keeps a subtree size");
+
+// размер каждого поддерева совпадает с числом узлов в нем
+size_t CheckCounts(s21::Node<int, void, true> *node) {
+  if (node == nullptr) return 0;
+  size_t count = 1 + CheckCounts(node->left) + CheckCounts(node->right);
+  EXPECT_EQ(node->count, count);
+  return count;
+}
+
+// случайные вставки и удаления: Nth, Rank и Index сверяются с
+// отсортированным std::set
+TEST(Tree, OrderStatisticRandom) {
+  std::mt19937 gen(7);
+  s21::Tree<int, void, true> tree;
+  std::set<int> keys;
+
+  for (int i = 0; i < 3000; ++i) {
+    int key = gen() % 500;
+    if (gen() % 3 != 0) {
+      tree.Insert(key);
+      keys.insert(key);
+    } else {
+      tree.Remove(key);
+      keys.erase(key);
+    }
+  }
+  ASSERT_EQ(CheckCounts(tree.GetRoot()), keys.size());
+  s21::Tree<int, void, true> copy(tree);
+  ASSERT_EQ(CheckCounts(copy.GetRoot()), keys.size());
+
+  size_t index = 0;
+  for (int key : keys) {
+    ASSERT_EQ(tree.Nth(index)->GetKey(), key);
+    ASSERT_EQ(tree.Rank(key), index);
+    ASSERT_EQ(tree.Index(tree.Search(key)), index);
+    ++index;
+  }
+  ASSERT_EQ(tree.Nth(keys.size()), nullptr);
+  ASSERT_EQ(tree.Index(nullptr), keys.size());
+  ASSERT_EQ(tree.Rank(-1), 0U);
+  ASSERT_EQ(tree.Rank(1000), keys.size());
+}
+
+TEST(Tree, OrderStatisticMulti) {
+  s21::Tree<int, void, true> tree;
+  for (int key : {5, 1, 5, 3, 5}) tree.InsertMulti(key);
+
+  ASSERT_EQ(tree.Rank(5), 2U);
+  ASSERT_EQ(tree.Nth(2)->GetKey(), 5);
+  ASSERT_EQ(tree.Nth(4)->GetKey(), 5);
+  tree.RemoveNode(tree.Nth(3));
+  ASSERT_EQ(CheckCounts(tree.GetRoot()), 4U);
+  ASSERT_EQ(tree.Nth(3)->GetKey(), 5);
+}
+
+// построение из отсортированных ключей дает корректное красно-черное дерево
+// любого размера, и оно дальше работает как обычное
+TEST(Tree, AssignSortedIsRedBlack) {
+  for (int n = 0; n < 200; ++n) {
+    std::vector<int> keys;
+    for (int i = 0; i < n; ++i) keys.push_back(i * 2);
+    s21::Tree<int> tree;
+    tree.Insert(-7);  // старое содержимое заменяется
+    tree.AssignSorted(keys.begin(), keys.size());
+
+    ASSERT_EQ(tree.GetSize(), static_cast<size_t>(n));
+    if (n == 0) {
+      ASSERT_EQ(tree.GetRoot(), nullptr);
+      ASSERT_EQ(tree.GetFirst(), nullptr);
+      continue;
+    }
+    ASSERT_FALSE(tree.GetRoot()->IsRed());
+    CheckRedBlack(tree.GetRoot(), nullptr);
+    ASSERT_EQ(tree.GetMin(), 0);
+    ASSERT_EQ(tree.GetMax(), (n - 1) * 2);
+
+    s21::Iterator<int> iter(tree.GetFirst(), tree.GetHeader());
+    for (int key : keys) {
+      ASSERT_EQ(*iter, key);
+      ++iter;
+    }
+    ASSERT_EQ(iter.node_, nullptr);
+
+    tree.Insert(n);
+    tree.Remove(0);
+    CheckRedBlack(tree.GetRoot(), nullptr);
+  }
+}
+
+TEST(Tree, AssignSortedCounted) {
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) keys.push_back(i);
+  s21::Tree<int, void, true> tree;
+  tree.AssignSorted(keys.begin(), keys.size());
+  ASSERT_EQ(CheckCounts(tree.GetRoot()), 1000U);
+  ASSERT_EQ(tree.Nth(517)->GetKey(), 517);
+  ASSERT_EQ(tree.Rank(250), 250U);
+}
+
+// после переноса узлов оба дерева остаются корректными красно-черными
+TEST(Tree, MergeKeepsBothTreesBalanced) {
+  std::mt19937 gen(13);
+  s21::Tree<int> tree;
+  s21::Tree<int> other;
+  std::set<int> keys;
+  std::set<int> other_keys;
+  for (int i = 0; i < 500; ++i) {
+    int key = gen() % 1000;
+    tree.Insert(key);
+    keys.insert(key);
+    key = gen() % 1000;
+    other.Insert(key);
+    other_keys.insert(key);
+  }
+  tree.Merge(other, true);
+
+  std::set<int> left;  // ключи, которые уже были в tree
+  for (int key : other_keys) {
+    if (keys.count(key) != 0) left.insert(key);
+    keys.insert(key);
+  }
+  ASSERT_EQ(tree.GetSize(), keys.size());
+  ASSERT_EQ(other.GetSize(), left.size());
+  CheckRedBlack(tree.GetRoot(), nullptr);
+  CheckRedBlack(other.GetRoot(), nullptr);
+  ASSERT_EQ(tree.GetMin(), *keys.begin());
+  ASSERT_EQ(other.GetMax(), *left.rbegin());
+
+  // результат может заменить один из аргументов
+  tree.AssignDifference(tree, other);
+  ASSERT_EQ(tree.GetSize(), keys.size() - left.size());
+  ASSERT_EQ(tree.Search(*left.begin()), nullptr);
+  CheckRedBlack(tree.GetRoot(), nullptr);
+}
+
+// содержимое дерева по порядку и проверка крайних узлов и размера
+std::vector<int> Keys(s21::Tree<int> &tree) {
+  std::vector<int> keys;
+  s21::Iterator<int> iter(tree.GetFirst(), tree.GetHeader());
+  for (; iter.node_ != nullptr; ++iter) keys.push_back(*iter);
+  EXPECT_EQ(tree.GetSize(), keys.size());
+  if (!keys.empty()) {
+    EXPECT_EQ(tree.GetMin(), keys.front());
+    EXPECT_EQ(tree.GetMax(), keys.back());
+    EXPECT_EQ(*--s21::Iterator<int>(nullptr, tree.GetHeader()), keys.back());
+  }
+  return keys;
+}
+
+// разрез в случайном месте сверяется с наивным разделением отсортированных
+// ключей, соединение половин обратно - с исходным деревом
+TEST(Tree, SplitJoinAgainstNaive) {
+  std::mt19937 gen(17);
+  for (int round = 0; round < 300; ++round) {
+    int n = round < 40 ? round : static_cast<int>(gen() % 2000);
+    s21::Tree<int> tree;
+    std::set<int> keys;
+    for (int i = 0; i < n; ++i) {
+      int key = gen() % 5000;
+      tree.Insert(key);
+      keys.insert(key);
+    }
+    int cut = static_cast<int>(gen() % 5200) - 100;
+    std::vector<int> less(keys.begin(), keys.lower_bound(cut));
+    std::vector<int> greater(keys.lower_bound(cut), keys.end());
+
+    s21::Tree<int> right;
+    right.Insert(-1);  // старое содержимое greater удаляется
+    tree.Split(cut, right);
+    ASSERT_EQ(Keys(tree), less);
+    ASSERT_EQ(Keys(right), greater);
+    CheckRedBlack(tree.GetRoot(), nullptr);
+    CheckRedBlack(right.GetRoot(), nullptr);
+
+    // по очереди: правое к левому и, для другого порядка, левое к правому
+    if (round % 2 == 0) {
+      ASSERT_TRUE(tree.Join(right, true));
+      ASSERT_EQ(Keys(tree), std::vector<int>(keys.begin(), keys.end()));
+      ASSERT_EQ(right.GetSize(), 0U);
+      ASSERT_EQ(right.GetRoot(), nullptr);
+      CheckRedBlack(tree.GetRoot(), nullptr);
+    } else {
+      ASSERT_TRUE(right.Join(tree, true));
+      ASSERT_EQ(Keys(right), std::vector<int>(keys.begin(), keys.end()));
+      ASSERT_EQ(tree.GetFirst(), nullptr);
+      CheckRedBlack(right.GetRoot(), nullptr);
+    }
+  }
+}
+
+// соединение деревьев очень разной высоты и пересекающиеся диапазоны
+TEST(Tree, JoinUnevenAndOverlapping) {
+  for (int small = 0; small < 70; ++small) {
+    s21::Tree<int> tree;
+    s21::Tree<int> other;
+    for (int key = 0; key < 3000; ++key) tree.Insert(key);
+    for (int key = 0; key < small; ++key) other.Insert(5000 + key);
+    ASSERT_TRUE(tree.Join(other, true));
+    ASSERT_EQ(tree.GetSize(), 3000U + small);
+    CheckRedBlack(tree.GetRoot(), nullptr);
+
+    for (int key = 0; key < small; ++key) other.Insert(-100 - key);
+    ASSERT_TRUE(other.Join(tree, true));
+    ASSERT_EQ(other.GetSize(), 3000U + 2 * small);
+    ASSERT_EQ(other.GetMax(), small == 0 ? 2999 : 5000 + small - 1);
+    CheckRedBlack(other.GetRoot(), nullptr);
+  }
+
+  s21::Tree<int> a;
+  s21::Tree<int> b;
+  for (int key = 0; key < 10; ++key) a.Insert(key);
+  for (int key = 9; key < 20; ++key) b.Insert(key);
+  ASSERT_FALSE(a.Join(b, true));
+  ASSERT_EQ(a.GetSize(), 10U);
+  ASSERT_EQ(b.GetSize(), 11U);
+  // равные ключи на стыке допустимы без unique
+  ASSERT_TRUE(a.Join(b, false));
+  ASSERT_EQ(a.GetSize(), 21U);
+  CheckRedBlack(a.GetRoot(), nullptr);
+}
+
+// счетчики поддеревьев остаются верными после разреза и соединения
+TEST(Tree, SplitJoinCounted) {
+  std::mt19937 gen(19);
+  s21::Tree<int, void, true> tree;
+  for (int key = 0; key < 1000; ++key) tree.Insert(key * 2);
+  for (int round = 0; round < 50; ++round) {
+    int cut = static_cast<int>(gen() % 2100);
+    s21::Tree<int, void, true> right;
+    tree.Split(cut, right);
+    size_t less = static_cast<size_t>(std::min(1000, (cut + 1) / 2));
+    ASSERT_EQ(tree.GetSize(), less);
+    ASSERT_EQ(right.GetSize(), 1000U - less);
+    ASSERT_EQ(CheckCounts(tree.GetRoot()), less);
+    ASSERT_EQ(CheckCounts(right.GetRoot()), 1000U - less);
+    if (less < 1000) {
+      ASSERT_EQ(right.Nth(0)->GetKey(), static_cast<int>(less) * 2);
+    }
+    ASSERT_TRUE(tree.Join(right, true));
+    ASSERT_EQ(CheckCounts(tree.GetRoot()), 1000U);
+    ASSERT_EQ(tree.Rank(cut), less);
+  }
+}
+
+// удаление диапазонов любой длины и положения: содержимое сверяется с
+// std::set, дерево остается красно-черным
+TEST(Tree, RemoveRangeAgainstNaive) {
+  std::mt19937 gen(31);
+  for (int round = 0; round < 300; ++round) {
+    s21::Tree<int> tree;
+    std::set<int> keys;
+    int n = static_cast<int>(gen() % 600);
+    for (int i = 0; i < n; ++i) {
+      int key = gen() % 1000;
+      tree.Insert(key);
+      keys.insert(key);
+    }
+    int lo = static_cast<int>(gen() % 1100) - 50;
+    int hi = round % 5 == 0 ? 2000 : lo + static_cast<int>(gen() % 300);
+    s21::Node<int> *last = tree.LowerBound(hi);
+    ASSERT_EQ(tree.RemoveRange(tree.LowerBound(lo), last), last);
+    keys.erase(keys.lower_bound(lo), keys.lower_bound(hi));
+
+    ASSERT_EQ(Keys(tree), std::vector<int>(keys.begin(), keys.end()));
+    CheckRedBlack(tree.GetRoot(), nullptr);
+    tree.Insert(lo);
+    CheckRedBlack(tree.GetRoot(), nullptr);
+  }
+}
+
+// равные ключи на границе: удаляется ровно часть [first, last)
+TEST(Tree, RemoveRangeDuplicates) {
+  s21::Tree<int> tree;
+  for (int key = 0; key < 100; ++key) {
+    for (int copy = 0; copy < 3; ++copy) tree.InsertMulti(key);
+  }
+  // со второй копии 10 до второй копии 50
+  s21::Iterator<int> from(tree.LowerBound(10), tree.GetHeader());
+  ++from;
+  s21::Iterator<int> to(tree.LowerBound(50), tree.GetHeader());
+  ++to;
+  tree.RemoveRange(from.node_, to.node_);
+  std::vector<int> keys = Keys(tree);
+  ASSERT_EQ(keys.size(), 300U - 120U);
+  ASSERT_EQ(std::count(keys.begin(), keys.end(), 10), 1);
+  ASSERT_EQ(std::count(keys.begin(), keys.end(), 30), 0);
+  ASSERT_EQ(std::count(keys.begin(), keys.end(), 50), 2);
+  CheckRedBlack(tree.GetRoot(), nullptr);
+
+  // весь диапазон
+  tree.RemoveRange(tree.GetFirst(), nullptr);
+  ASSERT_EQ(tree.GetSize(), 0U);
+  ASSERT_EQ(tree.GetRoot(), nullptr);
+}
+
+TEST(Tree, RemoveRangeCounted) {
+  s21::Tree<int, void, true> tree;
+  for (int key = 0; key < 1000; ++key) tree.Insert(key);
+  tree.RemoveRange(tree.Nth(100), tree.Nth(900));
+  ASSERT_EQ(tree.GetSize(), 200U);
+  ASSERT_EQ(CheckCounts(tree.GetRoot()), 200U);
+  ASSERT_EQ(tree.Nth(100)->GetKey(), 900);
+}
+
+// подсказки верные (LowerBound, предыдущий узел, end) и случайные: дерево
+// совпадает с std::set и остается красно-черным
+TEST(Tree, InsertUniqueHintAgainstNaive) {
+  std::mt19937 gen(41);
+  s21::Tree<int> tree;
+  std::set<int> keys;
+  s21::Node<int> *last = nullptr;
+  for (int i = 0; i < 5000; ++i) {
+    int key = gen() % 3000;
+    s21::Node<int> *hint = nullptr;
+    switch (gen() % 4) {
+      case 0:
+        hint = tree.LowerBound(key);
+        break;
+      case 1:
+        hint = last;
+        break;
+      case 2:
+        hint = tree.LowerBound(gen() % 3000);
+        break;
+      default:
+        break;
+    }
+    auto r = tree.InsertUniqueHint(hint, key);
+    ASSERT_EQ(r.second, keys.insert(key).second);
+    ASSERT_EQ(r.first->GetKey(), key);
+    last = r.first;
+  }
+  ASSERT_EQ(Keys(tree), std::vector<int>(keys.begin(), keys.end()));
+  CheckRedBlack(tree.GetRoot(), nullptr);
+}
+
+TEST(Tree, InsertUniqueHintCounted) {
+  s21::Tree<int, void, true> tree;
+  s21::Node<int, void, true> *last = nullptr;
+  for (int key = 0; key < 1000; key += 2) {
+    last = tree.InsertUniqueHint(last, key).first;
+  }
+  for (int key = 999; key > 0; key -= 2) {
+    last = tree.InsertUniqueHint(last, key).first;
+  }
+  ASSERT_EQ(CheckCounts(tree.GetRoot()), 1000U);
+  ASSERT_EQ(tree.Nth(377)->GetKey(), 377);
+}
+
+namespace {
+
+// значение, копирование которого бросает после заданного числа копий
+struct ThrowingValue {
+  static int copies_left;
+  ThrowingValue() {}
+  ThrowingValue(const ThrowingValue &) {
+    if (--copies_left < 0) throw std::runtime_error("copy failed");
+  }
+};
+int ThrowingValue::copies_left = 0;
+
+}  // namespace
+
+// копия повторяет форму и цвета, родители в копии - узлы копии
+TEST(Tree, CopyKeepsShapeAndOwnParents) {
+  std::mt19937 gen(59);
+  s21::Tree<int> tree;
+  for (int i = 0; i < 3000; ++i) tree.Insert(gen() % 10000);
+  s21::Tree<int> copy(tree);
+
+  ASSERT_EQ(Keys(copy), Keys(tree));
+  CheckRedBlack(copy.GetRoot(), nullptr);
+  std::vector<s21::Node<int> *> a{tree.GetRoot()};
+  std::vector<s21::Node<int> *> b{copy.GetRoot()};
+  while (!a.empty()) {
+    s21::Node<int> *x = a.back();
+    s21::Node<int> *y = b.back();
+    a.pop_back();
+    b.pop_back();
+    ASSERT_NE(x, y);
+    ASSERT_EQ(x->GetKey(), y->GetKey());
+    ASSERT_EQ(x->IsRed(), y->IsRed());
+    ASSERT_EQ(x->left == nullptr, y->left == nullptr);
+    ASSERT_EQ(x->right == nullptr, y->right == nullptr);
+    if (x->left != nullptr) {
+      a.push_back(x->left);
+      b.push_back(y->left);
+    }
+    if (x->right != nullptr) {
+      a.push_back(x->right);
+      b.push_back(y->right);
+    }
+  }
+
+  s21::Tree<int, void, true> counted;
+  for (int key = 0; key < 500; ++key) counted.Insert(key);
+  s21::Tree<int, void, true> counted_copy(counted);
+  ASSERT_EQ(CheckCounts(counted_copy.GetRoot()), 500U);
+  ASSERT_EQ(counted_copy.Nth(250)->GetKey(), 250);
+}
+
+// исключение при копировании значения не оставляет утечек (проверяет ASan)
+TEST(Tree, CopyThrowingValue) {
+  using ThrowingTree = s21::Tree<int, ThrowingValue>;
+  ThrowingTree tree;
+  for (int key = 0; key < 100; ++key) tree.InsertUnique(key);
+  ThrowingValue::copies_left = 50;
+  EXPECT_THROW(ThrowingTree{tree}, std::runtime_error);
+  ThrowingValue::copies_left = 1000;
+  ThrowingTree copy(tree);
+  EXPECT_EQ(copy.GetSize(), 100U);
+}
+
 // int main(int argc, char **argv) {
 //   ::testing::InitGoogleTest(&argc, argv);
 //   return RUN_ALL_TESTS();
@@ -0,0 +1,244 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "../s21_unordered_map.h"
+#include "../s21_unordered_set.h"
+
+namespace {
+
+// все ключи в одну группу: поиск обязан пройти по цепочке проб
+struct BadHash {
+  size_t operator()(int) const { return 42; }
+};
+
+}  // namespace
+
+TEST(UnorderedMap, MapInterface) {
+  s21::unordered_map<std::string, int> map{{"one", 1}, {"two", 2}};
+
+  EXPECT_EQ(map.size(), 2U);
+  EXPECT_EQ(map.at("two"), 2);
+  EXPECT_THROW(map.at("three"), std::out_of_range);
+  EXPECT_FALSE(map.insert("one", 10).second);
+  EXPECT_TRUE(map.insert(std::make_pair("three", 3)).second);
+  map["four"] = 4;
+  EXPECT_EQ(map["five"], 0);
+  EXPECT_EQ(map.insert_or_assign("one", 11).first->second, 11);
+  EXPECT_EQ(map.size(), 5U);
+  EXPECT_TRUE(map.contains("four"));
+  EXPECT_FALSE(map.contains("six"));
+  EXPECT_EQ(map.find("three")->first, "three");
+  EXPECT_EQ(map.find("six"), map.end());
+
+  map.erase(map.find("two"));
+  EXPECT_EQ(map.erase("five"), 1U);
+  EXPECT_EQ(map.erase("five"), 0U);
+  EXPECT_EQ(map.size(), 3U);
+
+  int sum = 0;
+  for (auto item : map) sum += item.second;
+  EXPECT_EQ(sum, 18);
+  map.find("four")->second = 40;
+  EXPECT_EQ(map.at("four"), 40);
+}
+
+TEST(UnorderedMap, CopyMoveSwapMerge) {
+  s21::unordered_map<int, int> map1{{1, 10}, {2, 20}};
+  s21::unordered_map<int, int> map2{{2, 0}, {3, 30}};
+  s21::unordered_map<int, int> copy(map1);
+
+  map1.merge(map2);
+  EXPECT_EQ(map1.size(), 3U);
+  EXPECT_EQ(map1.at(2), 20);
+  EXPECT_EQ(map2.size(), 1U);
+  EXPECT_EQ(map2.at(2), 0);
+  EXPECT_EQ(copy.size(), 2U);
+  copy[1] = 100;
+  EXPECT_EQ(map1.at(1), 10);
+
+  s21::unordered_map<int, int> moved(std::move(map1));
+  EXPECT_TRUE(map1.empty());
+  EXPECT_EQ(map1.begin(), map1.end());
+  moved.swap(map1);
+  EXPECT_EQ(map1.at(3), 30);
+  map1 = std::move(copy);
+  EXPECT_EQ(map1.at(1), 100);
+  map1.clear();
+  EXPECT_TRUE(map1.empty());
+  EXPECT_FALSE(map1.contains(1));
+  map1[7] = 7;
+  EXPECT_EQ(map1.size(), 1U);
+}
+
+TEST(UnorderedMap, RandomAgainstStdMap) {
+  std::mt19937 gen(6);
+  s21::unordered_map<int, int> map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 30000; ++i) {
+    int key = gen() % 2000;
+    if (gen() % 2 == 0) {
+      ASSERT_EQ(map.insert(key, i).second, std_map.insert({key, i}).second);
+    } else {
+      ASSERT_EQ(map.erase(key), std_map.erase(key));
+    }
+  }
+  ASSERT_EQ(map.size(), std_map.size());
+  for (auto &item : std_map) {
+    ASSERT_EQ(map.at(item.first), item.second);
+  }
+  size_t visited = 0;
+  for (auto iter = map.begin(); iter != map.end(); ++iter, ++visited) {
+    ASSERT_EQ(std_map.at(iter->first), iter->second);
+  }
+  ASSERT_EQ(visited, std_map.size());
+  ASSERT_LE(map.load_factor(), map.max_load_factor());
+}
+
+TEST(UnorderedMap, LoadFactorPolicy) {
+  s21::unordered_map<int, int> map;
+  EXPECT_FLOAT_EQ(map.max_load_factor(), 0.875f);
+  EXPECT_EQ(map.bucket_count(), 0U);
+
+  map.max_load_factor(0.5f);
+  for (int key = 0; key < 1000; ++key) map[key] = key;
+  EXPECT_LE(map.load_factor(), 0.5f);
+  EXPECT_GE(map.bucket_count(), 2000U);
+
+  map.max_load_factor(0.9f);
+  map.rehash(0);
+  EXPECT_EQ(map.bucket_count(), 2048U);
+  EXPECT_GT(map.load_factor(), 0.45f);
+
+  map.max_load_factor(2.0f);
+  EXPECT_LE(map.max_load_factor(), 0.9375f);
+
+  map.reserve(10000);
+  size_t buckets = map.bucket_count();
+  for (int key = 1000; key < 9000; ++key) map[key] = key;
+  EXPECT_EQ(map.bucket_count(), buckets);
+  EXPECT_EQ(map.at(8999), 8999);
+}
+
+TEST(UnorderedMap, TombstonesAreReused) {
+  s21::unordered_map<int, int> map;
+  map.reserve(100);
+  size_t buckets = map.bucket_count();
+  for (int round = 0; round < 100; ++round) {
+    for (int key = 0; key < 50; ++key) map[round * 50 + key] = key;
+    for (int key = 0; key < 50; ++key) map.erase(round * 50 + key);
+  }
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.bucket_count(), buckets);
+}
+
+TEST(UnorderedMap, CollidingHashes) {
+  s21::unordered_map<int, int, BadHash> map;
+  for (int key = 0; key < 100; ++key) map[key] = key * 2;
+  for (int key = 0; key < 100; key += 2) map.erase(key);
+
+  EXPECT_EQ(map.size(), 50U);
+  for (int key = 0; key < 100; ++key) {
+    EXPECT_EQ(map.contains(key), key % 2 == 1);
+  }
+  EXPECT_EQ(map.at(99), 198);
+}
+
+namespace {
+
+// значение, присваивание которого бросает, когда запас исчерпан
+struct ThrowingValue {
+  static int copies_left;
+  int value = 0;
+  ThrowingValue() = default;
+  explicit ThrowingValue(int v) : value(v) {}
+  ThrowingValue(const ThrowingValue &other) = default;
+  ThrowingValue &operator=(const ThrowingValue &other) {
+    if (--copies_left < 0) throw std::runtime_error("copy failed");
+    value = other.value;
+    return *this;
+  }
+};
+int ThrowingValue::copies_left = 1 << 30;
+
+}  // namespace
+
+// неудачная вставка не оставляет ключ со значением по умолчанию
+TEST(UnorderedMap, ThrowingInsertLeavesNoEntry) {
+  s21::unordered_map<int, ThrowingValue> map;
+  for (int key = 0; key < 20; ++key) map.insert(key, ThrowingValue(key));
+
+  ThrowingValue::copies_left = 0;
+  EXPECT_THROW(map.insert(100, ThrowingValue(100)), std::runtime_error);
+  EXPECT_THROW(map.insert_or_assign(101, ThrowingValue(101)),
+               std::runtime_error);
+  ThrowingValue::copies_left = 1 << 30;
+  EXPECT_EQ(map.size(), 20U);
+  EXPECT_FALSE(map.contains(100));
+  EXPECT_FALSE(map.contains(101));
+  int sum = 0;
+  for (auto item : map) sum += item.second.value;
+  EXPECT_EQ(sum, 190);
+
+  EXPECT_TRUE(map.insert(100, ThrowingValue(100)).second);
+  EXPECT_EQ(map.at(100).value, 100);
+}
+
+// через const HashTable значения только читаются
+TEST(UnorderedMap, ConstTableValuesAreReadOnly) {
+  using Table = s21::HashTable<int, int, std::hash<int>, std::equal_to<int>>;
+  Table table;
+  table.Value(table.Insert(7).first) = 70;
+  const Table &view = table;
+  EXPECT_EQ(view.Value(view.Find(7)), 70);
+  EXPECT_TRUE((std::is_same<decltype(view.Value(0)), const int &>::value));
+  EXPECT_TRUE((std::is_same<decltype(table.Value(0)), int &>::value));
+}
+
+TEST(UnorderedSet, AgainstStdSet) {
+  std::mt19937 gen(8);
+  s21::unordered_set<std::string> set;
+  std::set<std::string> std_set;
+  for (int i = 0; i < 5000; ++i) {
+    std::string key = "id" + std::to_string(gen() % 800);
+    if (gen() % 3 != 0) {
+      ASSERT_EQ(set.insert(key).second, std_set.insert(key).second);
+    } else if (set.contains(key)) {
+      set.erase(set.find(key));
+      std_set.erase(key);
+    }
+  }
+  ASSERT_EQ(set.size(), std_set.size());
+  std::set<std::string> seen;
+  for (const std::string &key : set) seen.insert(key);
+  ASSERT_EQ(seen, std_set);
+}
+
+TEST(UnorderedSet, SetInterface) {
+  s21::unordered_set<int> set{3, 1, 3, 2};
+  s21::unordered_set<int> other{2, 4};
+
+  EXPECT_EQ(set.size(), 3U);
+  set.merge(other);
+  EXPECT_EQ(set.size(), 4U);
+  EXPECT_TRUE(set.contains(4));
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_TRUE(other.contains(2));
+  EXPECT_EQ(set.erase(1), 1U);
+  EXPECT_EQ(set.find(1), set.end());
+
+  s21::unordered_set<int> copy(set);
+  set.swap(other);
+  EXPECT_EQ(set.size(), 1U);
+  EXPECT_EQ(copy.size(), 3U);
+  set = std::move(copy);
+  EXPECT_EQ(set.size(), 3U);
+  set.clear();
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.max_size(), other.max_size());
+}
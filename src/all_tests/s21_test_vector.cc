@@ -555,6 +555,17 @@ TYPED_TEST(VectorTest, Clear) {
   EXPECT_EQ(vec.capacity(), std_vec.capacity());
 }
 
+// после clear буфер остается, вектор можно заполнять заново
+TEST(Modifiers, PushBackAfterClear) {
+  s21::Vector<std::string> vec{"a", "b", "c"};
+
+  vec.clear();
+  vec.push_back("d");
+  EXPECT_EQ(vec.size(), 1U);
+  EXPECT_EQ(vec.capacity(), 3U);
+  EXPECT_EQ(vec[0], "d");
+}
+
 // modifiers: insert, erase, push back, pop back
 TEST(Modifiers, IntNotEmptyModifiers) {
   s21::Vector<int> vec{1, 2, 3, 4, 5};
@@ -0,0 +1,648 @@
+#ifndef CPP2_SRC_BTREE_H_
+#define CPP2_SRC_BTREE_H_
+
+#include <algorithm>  // для std::lower_bound, std::upper_bound, std::move
+#include <cstddef>
+#include <limits>       // для std::numeric_limits
+#include <type_traits>  // для std::is_void
+#include <utility>      // для std::pair
+
+#include "pair_ref.h"
+
+namespace s21 {
+
+/**
+ * B+ дерево для btree_map / btree_set:
+ * - все ключи лежат в листьях, листья связаны в двусвязный список для обхода
+ * - внутренние узлы хранят только разделители и указатели на детей
+ * - в узле до N ключей подряд в одном массиве, поиск внутри узла бинарный,
+ *   поэтому на каждый уровень приходится один-два промаха кэша, а уровней
+ *   в несколько раз меньше, чем у красно-черного дерева
+ *
+ * Здесь пять классов:
+ * - BTreeNode (общая часть узла: массив ключей)
+ * - BTreeLeaf (лист: ключи, значения, соседние листья)
+ * - BTreeInner (внутренний узел: разделители и дети)
+ * - BTree
+ * - BTreeIterator
+ */
+
+// число ключей в узле: около 256 байт ключей, но не меньше 4 и не больше 64
+template <typename T>
+constexpr size_t BTreeSlots() {
+  return 256 / sizeof(T) < 4 ? 4 : 256 / sizeof(T) > 64 ? 64 : 256 / sizeof(T);
+}
+
+// ========== УЗЛЫ ============== //
+
+template <typename T, size_t N>
+class BTreeNode {
+ public:
+  bool is_leaf;  // лист или внутренний узел
+  size_t count;  // число ключей в узле
+  T keys[N];     // отсортированные ключи (в листе) или разделители
+
+  explicit BTreeNode(bool leaf) : is_leaf(leaf), count(0), keys() {}
+};
+
+// значения лежат в листе рядом с ключами; у множества (V = void) их нет и
+// лист не становится больше
+template <typename V, size_t N>
+struct BTreeValues {
+  V vals[N];
+};
+
+template <size_t N>
+struct BTreeValues<void, N> {};
+
+template <typename T, typename V, size_t N>
+class BTreeLeaf : public BTreeNode<T, N>, public BTreeValues<V, N> {
+ public:
+  BTreeLeaf<T, V, N>* prev;  // соседний лист слева
+  BTreeLeaf<T, V, N>* next;  // соседний лист справа
+
+  BTreeLeaf()
+      : BTreeNode<T, N>(true),
+        BTreeValues<V, N>(),
+        prev(nullptr),
+        next(nullptr) {}
+};
+
+// в поддереве children[i] ключи из [keys[i - 1], keys[i])
+template <typename T, size_t N>
+class BTreeInner : public BTreeNode<T, N> {
+ public:
+  BTreeNode<T, N>* children[N + 1];
+
+  BTreeInner() : BTreeNode<T, N>(false), children() {}
+};
+
+// ========== КЛАСС B+ ДЕРЕВА ============== //
+
+// Ключи уникальные. Вставка и удаление - рекурсивный спуск от корня (глубина
+// маленькая), переполненный узел делится пополам, узел, в котором осталось
+// меньше kMin ключей, занимает ключ у соседа или сливается с ним.
+// Вставка и удаление делают недействительными итераторы на этот лист и его
+// соседей, как у любого B-дерева
+template <typename T, typename V, size_t N = BTreeSlots<T>()>
+class BTree {
+  static_assert(N >= 4, "a B-tree node needs at least 4 slots");
+
+ public:
+  using node_type = BTreeNode<T, N>;
+  using leaf_type = BTreeLeaf<T, V, N>;
+  using inner_type = BTreeInner<T, N>;
+
+  // КОНСТРУКТОРЫ И ДЕСТРУКТОРЫ
+  BTree();
+  BTree(const BTree& copy);
+  BTree(BTree&& other);
+  ~BTree();
+
+  BTree& operator=(BTree&& other);
+
+  // ОСНОВНЫЕ ПУБЛИЧНЫЕ МЕТОДЫ
+  // вставка ключа, если его еще нет; возвращает <лист, позиция в листе> этого
+  // ключа и была ли вставка. Значение нового ключа - по умолчанию
+  std::pair<std::pair<leaf_type*, size_t>, bool> Insert(const T& key);
+  // удаление ключа, возвращает false если ключа не было
+  bool Remove(const T& key);
+  // <лист, позиция> ключа или <nullptr, 0>
+  std::pair<leaf_type*, size_t> Search(const T& key) const;
+  // первый ключ не меньше / строго больше key, <nullptr, 0> если такого нет
+  std::pair<leaf_type*, size_t> LowerBound(const T& key) const;
+  std::pair<leaf_type*, size_t> UpperBound(const T& key) const;
+
+  void Clear();
+  void Swap(BTree& other);
+  size_t MaxSize() const;
+
+  size_t GetSize() const { return size; }
+  node_type* GetRoot() const { return root; }
+  leaf_type* GetFirst() const { return first; }
+  leaf_type* GetLast() const { return last; }
+
+ private:
+  // меньше kMin ключей бывает только в корне
+  static constexpr size_t kMin = N / 2 - 1;
+
+  node_type* root;
+  leaf_type* first;  // самый левый лист, для begin()
+  leaf_type* last;   // самый правый лист, для --end()
+  size_t size;
+
+  // результат вставки в поддерево: где оказался ключ и, если узел пришлось
+  // разделить, новый правый узел и разделитель для родителя
+  struct InsertResult {
+    leaf_type* leaf;
+    size_t pos;
+    bool inserted;
+    node_type* split;
+    T separator;
+  };
+
+  InsertResult InsertInto(node_type* node, const T& key);
+  InsertResult InsertIntoLeaf(leaf_type* leaf, const T& key);
+  bool RemoveFrom(node_type* node, const T& key);
+  // чинит ребенка i у родителя, если в нем меньше kMin ключей
+  void Rebalance(inner_type* parent, size_t i);
+  void MergeLeaves(inner_type* parent, size_t i);
+  void MergeInner(inner_type* parent, size_t i);
+  // удаляет из внутреннего узла разделитель i и ребенка i + 1
+  static void EraseSeparator(inner_type* node, size_t i);
+
+  static void MoveSlot(leaf_type* from, size_t i, leaf_type* to, size_t j);
+  static void ShiftRight(leaf_type* leaf, size_t pos);
+  static void ShiftLeft(leaf_type* leaf, size_t pos);
+
+  static void Destroy(node_type* node);
+  // копирует поддерево, листья копии связываются по порядку через prev
+  node_type* CopyNode(const node_type* node, leaf_type*& prev);
+};
+
+template <typename T, typename V, size_t N>
+BTree<T, V, N>::BTree()
+    : root(nullptr), first(nullptr), last(nullptr), size(0) {}
+
+template <typename T, typename V, size_t N>
+BTree<T, V, N>::BTree(const BTree& copy) : BTree() {
+  leaf_type* prev = nullptr;
+  root = CopyNode(copy.root, prev);
+  last = prev;
+  size = copy.size;
+}
+
+template <typename T, typename V, size_t N>
+BTree<T, V, N>::BTree(BTree&& other) : BTree() {
+  Swap(other);
+}
+
+template <typename T, typename V, size_t N>
+BTree<T, V, N>::~BTree() {
+  Destroy(root);
+}
+
+template <typename T, typename V, size_t N>
+BTree<T, V, N>& BTree<T, V, N>::operator=(BTree&& other) {
+  if (this != &other) {
+    Clear();
+    Swap(other);
+  }
+  return *this;
+}
+
+template <typename T, typename V, size_t N>
+std::pair<std::pair<BTreeLeaf<T, V, N>*, size_t>, bool> BTree<T, V, N>::Insert(
+    const T& key) {
+  if (root == nullptr) {
+    root = first = last = new leaf_type();
+  }
+  InsertResult r = InsertInto(root, key);
+  if (r.split != nullptr) {
+    // корень разделился: дерево растет на один уровень вверх
+    inner_type* new_root = new inner_type();
+    new_root->keys[0] = r.separator;
+    new_root->children[0] = root;
+    new_root->children[1] = r.split;
+    new_root->count = 1;
+    root = new_root;
+  }
+  if (r.inserted) size++;
+  return std::make_pair(std::make_pair(r.leaf, r.pos), r.inserted);
+}
+
+template <typename T, typename V, size_t N>
+typename BTree<T, V, N>::InsertResult BTree<T, V, N>::InsertInto(
+    node_type* node, const T& key) {
+  if (node->is_leaf) {
+    return InsertIntoLeaf(static_cast<leaf_type*>(node), key);
+  }
+  inner_type* inner = static_cast<inner_type*>(node);
+  size_t i = std::upper_bound(inner->keys, inner->keys + inner->count, key) -
+             inner->keys;
+  InsertResult r = InsertInto(inner->children[i], key);
+  if (r.split == nullptr) return r;
+
+  // ребенок i разделился: разделитель встает на место i, новый ребенок - i + 1
+  inner_type* target = inner;
+  node_type* split = nullptr;
+  T separator{};
+  if (inner->count == N) {
+    // делим сам узел: средний разделитель уходит к родителю
+    size_t mid = N / 2;
+    inner_type* right = new inner_type();
+    right->count = N - mid - 1;
+    std::move(inner->keys + mid + 1, inner->keys + N, right->keys);
+    std::copy(inner->children + mid + 1, inner->children + N + 1,
+              right->children);
+    separator = std::move(inner->keys[mid]);
+    inner->count = mid;
+    split = right;
+    if (i > mid) {
+      target = right;
+      i -= mid + 1;
+    }
+  }
+  std::move_backward(target->keys + i, target->keys + target->count,
+                     target->keys + target->count + 1);
+  std::copy_backward(target->children + i + 1,
+                     target->children + target->count + 1,
+                     target->children + target->count + 2);
+  target->keys[i] = std::move(r.separator);
+  target->children[i + 1] = r.split;
+  target->count++;
+
+  r.split = split;
+  r.separator = std::move(separator);
+  return r;
+}
+
+template <typename T, typename V, size_t N>
+typename BTree<T, V, N>::InsertResult BTree<T, V, N>::InsertIntoLeaf(
+    leaf_type* leaf, const T& key) {
+  size_t pos =
+      std::lower_bound(leaf->keys, leaf->keys + leaf->count, key) - leaf->keys;
+  if (pos < leaf->count && !(key < leaf->keys[pos])) {
+    return InsertResult{leaf, pos, false, nullptr, T{}};
+  }
+
+  leaf_type* target = leaf;
+  leaf_type* right = nullptr;
+  if (leaf->count == N) {
+    // правая половина переезжает в новый лист справа
+    size_t mid = N / 2;
+    right = new leaf_type();
+    for (size_t j = mid; j < N; ++j) MoveSlot(leaf, j, right, j - mid);
+    right->count = N - mid;
+    leaf->count = mid;
+    right->prev = leaf;
+    right->next = leaf->next;
+    if (leaf->next != nullptr) {
+      leaf->next->prev = right;
+    } else {
+      last = right;
+    }
+    leaf->next = right;
+    if (pos > mid) {
+      target = right;
+      pos -= mid;
+    }
+  }
+  ShiftRight(target, pos);
+  target->keys[pos] = key;
+  if constexpr (!std::is_void<V>::value) target->vals[pos] = V();
+  target->count++;
+
+  if (right == nullptr) return InsertResult{target, pos, true, nullptr, T{}};
+  return InsertResult{target, pos, true, right, right->keys[0]};
+}
+
+template <typename T, typename V, size_t N>
+bool BTree<T, V, N>::Remove(const T& key) {
+  if (root == nullptr || !RemoveFrom(root, key)) return false;
+  size--;
+  if (root->count == 0) {
+    // корень опустел: у внутреннего остался один ребенок, лист удаляем
+    node_type* old = root;
+    if (root->is_leaf) {
+      root = first = last = nullptr;
+    } else {
+      root = static_cast<inner_type*>(root)->children[0];
+    }
+    if (old->is_leaf) {
+      delete static_cast<leaf_type*>(old);
+    } else {
+      delete static_cast<inner_type*>(old);
+    }
+  }
+  return true;
+}
+
+template <typename T, typename V, size_t N>
+bool BTree<T, V, N>::RemoveFrom(node_type* node, const T& key) {
+  if (node->is_leaf) {
+    leaf_type* leaf = static_cast<leaf_type*>(node);
+    size_t pos = std::lower_bound(leaf->keys, leaf->keys + leaf->count, key) -
+                 leaf->keys;
+    if (pos == leaf->count || key < leaf->keys[pos]) return false;
+    ShiftLeft(leaf, pos);
+    leaf->count--;
+    return true;
+  }
+  inner_type* inner = static_cast<inner_type*>(node);
+  size_t i = std::upper_bound(inner->keys, inner->keys + inner->count, key) -
+             inner->keys;
+  if (!RemoveFrom(inner->children[i], key)) return false;
+  if (inner->children[i]->count < kMin) Rebalance(inner, i);
+  return true;
+}
+
+/**
+ * Ребенок i потерял ключ и в нем меньше kMin ключей:
+ * - если у соседа слева или справа ключей больше kMin, забираем один
+ *   (через разделитель у родителя)
+ * - иначе сливаем ребенка с соседом в один узел
+ */
+template <typename T, typename V, size_t N>
+void BTree<T, V, N>::Rebalance(inner_type* parent, size_t i) {
+  node_type* child = parent->children[i];
+  node_type* left = i > 0 ? parent->children[i - 1] : nullptr;
+  node_type* right = i < parent->count ? parent->children[i + 1] : nullptr;
+
+  if (child->is_leaf) {
+    leaf_type* leaf = static_cast<leaf_type*>(child);
+    if (left != nullptr && left->count > kMin) {
+      leaf_type* from = static_cast<leaf_type*>(left);
+      ShiftRight(leaf, 0);
+      MoveSlot(from, from->count - 1, leaf, 0);
+      from->count--;
+      leaf->count++;
+      parent->keys[i - 1] = leaf->keys[0];
+    } else if (right != nullptr && right->count > kMin) {
+      leaf_type* from = static_cast<leaf_type*>(right);
+      MoveSlot(from, 0, leaf, leaf->count);
+      ShiftLeft(from, 0);
+      from->count--;
+      leaf->count++;
+      parent->keys[i] = from->keys[0];
+    } else {
+      MergeLeaves(parent, left != nullptr ? i - 1 : i);
+    }
+    return;
+  }
+
+  inner_type* inner = static_cast<inner_type*>(child);
+  if (left != nullptr && left->count > kMin) {
+    // разделитель родителя спускается в начало, последний ключ соседа
+    // поднимается на его место вместе с последним ребенком соседа
+    inner_type* from = static_cast<inner_type*>(left);
+    std::move_backward(inner->keys, inner->keys + inner->count,
+                       inner->keys + inner->count + 1);
+    std::copy_backward(inner->children, inner->children + inner->count + 1,
+                       inner->children + inner->count + 2);
+    inner->keys[0] = std::move(parent->keys[i - 1]);
+    inner->children[0] = from->children[from->count];
+    parent->keys[i - 1] = std::move(from->keys[from->count - 1]);
+    from->count--;
+    inner->count++;
+  } else if (right != nullptr && right->count > kMin) {
+    inner_type* from = static_cast<inner_type*>(right);
+    inner->keys[inner->count] = std::move(parent->keys[i]);
+    inner->children[inner->count + 1] = from->children[0];
+    parent->keys[i] = std::move(from->keys[0]);
+    std::move(from->keys + 1, from->keys + from->count, from->keys);
+    std::copy(from->children + 1, from->children + from->count + 1,
+              from->children);
+    from->count--;
+    inner->count++;
+  } else {
+    MergeInner(parent, left != nullptr ? i - 1 : i);
+  }
+}
+
+// лист i + 1 дописывается в конец листа i и удаляется
+template <typename T, typename V, size_t N>
+void BTree<T, V, N>::MergeLeaves(inner_type* parent, size_t i) {
+  leaf_type* left = static_cast<leaf_type*>(parent->children[i]);
+  leaf_type* right = static_cast<leaf_type*>(parent->children[i + 1]);
+  for (size_t j = 0; j < right->count; ++j) {
+    MoveSlot(right, j, left, left->count + j);
+  }
+  left->count += right->count;
+  left->next = right->next;
+  if (right->next != nullptr) {
+    right->next->prev = left;
+  } else {
+    last = left;
+  }
+  delete right;
+  EraseSeparator(parent, i);
+}
+
+// разделитель i спускается между ключами детей i и i + 1
+template <typename T, typename V, size_t N>
+void BTree<T, V, N>::MergeInner(inner_type* parent, size_t i) {
+  inner_type* left = static_cast<inner_type*>(parent->children[i]);
+  inner_type* right = static_cast<inner_type*>(parent->children[i + 1]);
+  left->keys[left->count] = std::move(parent->keys[i]);
+  std::move(right->keys, right->keys + right->count,
+            left->keys + left->count + 1);
+  std::copy(right->children, right->children + right->count + 1,
+            left->children + left->count + 1);
+  left->count += right->count + 1;
+  delete right;
+  EraseSeparator(parent, i);
+}
+
+template <typename T, typename V, size_t N>
+void BTree<T, V, N>::EraseSeparator(inner_type* node, size_t i) {
+  std::move(node->keys + i + 1, node->keys + node->count, node->keys + i);
+  std::copy(node->children + i + 2, node->children + node->count + 1,
+            node->children + i + 1);
+  node->count--;
+}
+
+// переносит ключ (и значение) из from[i] в to[j]
+template <typename T, typename V, size_t N>
+void BTree<T, V, N>::MoveSlot(leaf_type* from, size_t i, leaf_type* to,
+                              size_t j) {
+  to->keys[j] = std::move(from->keys[i]);
+  if constexpr (!std::is_void<V>::value) to->vals[j] = std::move(from->vals[i]);
+}
+
+// освобождает место pos, сдвигая хвост листа на один вправо
+template <typename T, typename V, size_t N>
+void BTree<T, V, N>::ShiftRight(leaf_type* leaf, size_t pos) {
+  for (size_t j = leaf->count; j > pos; --j) MoveSlot(leaf, j - 1, leaf, j);
+}
+
+// затирает место pos, сдвигая хвост листа на один влево
+template <typename T, typename V, size_t N>
+void BTree<T, V, N>::ShiftLeft(leaf_type* leaf, size_t pos) {
+  for (size_t j = pos + 1; j < leaf->count; ++j) MoveSlot(leaf, j, leaf, j - 1);
+}
+
+// спуск по разделителям до листа, дальше бинарный поиск в листе
+template <typename T, typename V, size_t N>
+std::pair<BTreeLeaf<T, V, N>*, size_t> BTree<T, V, N>::LowerBound(
+    const T& key) const {
+  if (root == nullptr) return std::make_pair(nullptr, 0);
+  const node_type* node = root;
+  while (!node->is_leaf) {
+    const inner_type* inner = static_cast<const inner_type*>(node);
+    node = inner->children[std::upper_bound(inner->keys,
+                                            inner->keys + inner->count, key) -
+                           inner->keys];
+  }
+  leaf_type* leaf = const_cast<leaf_type*>(static_cast<const leaf_type*>(node));
+  size_t pos =
+      std::lower_bound(leaf->keys, leaf->keys + leaf->count, key) - leaf->keys;
+  // все ключи листа меньше key: ответ - первый ключ следующего листа
+  if (pos == leaf->count) return std::make_pair(leaf->next, 0);
+  return std::make_pair(leaf, pos);
+}
+
+template <typename T, typename V, size_t N>
+std::pair<BTreeLeaf<T, V, N>*, size_t> BTree<T, V, N>::UpperBound(
+    const T& key) const {
+  std::pair<leaf_type*, size_t> r = LowerBound(key);
+  if (r.first != nullptr && !(key < r.first->keys[r.second])) {
+    if (++r.second == r.first->count) r = std::make_pair(r.first->next, 0);
+  }
+  return r;
+}
+
+template <typename T, typename V, size_t N>
+std::pair<BTreeLeaf<T, V, N>*, size_t> BTree<T, V, N>::Search(
+    const T& key) const {
+  std::pair<leaf_type*, size_t> r = LowerBound(key);
+  if (r.first == nullptr || key < r.first->keys[r.second]) {
+    return std::make_pair(nullptr, 0);
+  }
+  return r;
+}
+
+template <typename T, typename V, size_t N>
+void BTree<T, V, N>::Clear() {
+  Destroy(root);
+  root = nullptr;
+  first = last = nullptr;
+  size = 0;
+}
+
+template <typename T, typename V, size_t N>
+void BTree<T, V, N>::Swap(BTree& other) {
+  std::swap(root, other.root);
+  std::swap(first, other.first);
+  std::swap(last, other.last);
+  std::swap(size, other.size);
+}
+
+// как у Tree: половина адресного пространства на размер ключа
+template <typename T, typename V, size_t N>
+size_t BTree<T, V, N>::MaxSize() const {
+  return std::numeric_limits<size_t>::max() / 2 / sizeof(T);
+}
+
+template <typename T, typename V, size_t N>
+void BTree<T, V, N>::Destroy(node_type* node) {
+  if (node == nullptr) return;
+  if (node->is_leaf) {
+    delete static_cast<leaf_type*>(node);
+    return;
+  }
+  inner_type* inner = static_cast<inner_type*>(node);
+  for (size_t i = 0; i <= inner->count; ++i) Destroy(inner->children[i]);
+  delete inner;
+}
+
+template <typename T, typename V, size_t N>
+BTreeNode<T, N>* BTree<T, V, N>::CopyNode(const node_type* node,
+                                          leaf_type*& prev) {
+  if (node == nullptr) return nullptr;
+  if (node->is_leaf) {
+    const leaf_type* leaf = static_cast<const leaf_type*>(node);
+    leaf_type* copy = new leaf_type();
+    std::copy(leaf->keys, leaf->keys + leaf->count, copy->keys);
+    if constexpr (!std::is_void<V>::value) {
+      std::copy(leaf->vals, leaf->vals + leaf->count, copy->vals);
+    }
+    copy->count = leaf->count;
+    copy->prev = prev;
+    if (prev != nullptr) {
+      prev->next = copy;
+    } else {
+      first = copy;
+    }
+    prev = copy;
+    return copy;
+  }
+  const inner_type* inner = static_cast<const inner_type*>(node);
+  inner_type* copy = new inner_type();
+  std::copy(inner->keys, inner->keys + inner->count, copy->keys);
+  copy->count = inner->count;
+  for (size_t i = 0; i <= inner->count; ++i) {
+    copy->children[i] = CopyNode(inner->children[i], prev);
+  }
+  return copy;
+}
+
+// ========== КЛАСС ИТЕРАТОР ========== //
+// Позиция - лист и номер ключа в нем, end() - leaf_ == nullptr.
+// Указатель на дерево нужен, чтобы из end() шагнуть назад на последний лист
+template <typename T, typename V, size_t N = BTreeSlots<T>()>
+class BTreeIterator {
+ public:
+  BTreeLeaf<T, V, N>* leaf_;
+  size_t index_;
+  const BTree<T, V, N>* tree_;
+
+  BTreeIterator(BTreeLeaf<T, V, N>* leaf, size_t index,
+                const BTree<T, V, N>* tree)
+      : leaf_(leaf), index_(index), tree_(tree) {}
+
+  // у btree_set - ключ, у btree_map - пара ссылок на ключ и значение.
+  // Ключ менять нельзя: он определяет место в дереве
+  using reference = typename ElementRef<T, V>::type;
+
+  reference operator*() const {
+    if constexpr (std::is_void<V>::value) {
+      return leaf_->keys[index_];
+    } else {
+      return reference(leaf_->keys[index_], leaf_->vals[index_]);
+    }
+  }
+
+  // только для btree_map
+  template <typename U = V>
+  PairArrow<T, U> operator->() const {
+    return PairArrow<T, U>(leaf_->keys[index_], leaf_->vals[index_]);
+  }
+
+  // после последнего ключа переходим в end(), дальше end() не двигается
+  BTreeIterator& operator++() {
+    if (leaf_ != nullptr && ++index_ == leaf_->count) {
+      leaf_ = leaf_->next;
+      index_ = 0;
+    }
+    return *this;
+  }
+
+  BTreeIterator operator++(int) {
+    BTreeIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  // из end() - на последний ключ, с первого ключа никуда не двигается
+  BTreeIterator& operator--() {
+    if (leaf_ == nullptr) {
+      leaf_ = tree_->GetLast();
+      if (leaf_ != nullptr) index_ = leaf_->count - 1;
+    } else if (index_ > 0) {
+      --index_;
+    } else if (leaf_->prev != nullptr) {
+      leaf_ = leaf_->prev;
+      index_ = leaf_->count - 1;
+    }
+    return *this;
+  }
+
+  BTreeIterator operator--(int) {
+    BTreeIterator tmp = *this;
+    --(*this);
+    return tmp;
+  }
+
+  bool operator==(const BTreeIterator& other) const {
+    return leaf_ == other.leaf_ && index_ == other.index_;
+  }
+
+  bool operator!=(const BTreeIterator& other) const {
+    return !(*this == other);
+  }
+};  // end class BTreeIterator
+
+}  // namespace s21
+
+#endif  // CPP2_SRC_BTREE_H_
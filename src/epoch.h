@@ -0,0 +1,164 @@
+#ifndef CPP2_SRC_EPOCH_H_
+#define CPP2_SRC_EPOCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+/**
+ * Освобождение памяти по эпохам для контейнеров, которые читают без
+ * блокировок (rcu_map, concurrent_skip_map):
+ * - поток перед чтением берет EpochGuard: увеличивает счетчик текущей эпохи
+ *   в своем слоте, слоты на отдельных кэш-линиях
+ * - объект, который больше не достижим из контейнера, передается в
+ *   Retire() вместе с номером эпохи и освобождается, когда в слотах не
+ *   останется потоков этой и более ранних эпох
+ * - эпоха сдвигается в Retire(), если в слотах нет потоков прошлой эпохи;
+ *   никто не ждет читателей, поток, вытесненный посреди чтения, только
+ *   задерживает освобождение
+ *
+ * Free - функтор, освобождающий T*. Здесь два класса:
+ * - EpochDomain
+ * - EpochGuard
+ */
+
+template <typename T, typename Free>
+class EpochDomain;
+
+// ========== КЛАСС ЗАЩИТЫ ЧТЕНИЯ ========== //
+// Пока guard жив, объекты, доступные потоку в момент входа, не
+// освобождаются. Копия защищает ту же эпоху, поэтому итераторы с guard
+// внутри можно копировать
+class EpochGuard {
+ public:
+  EpochGuard() : counter_(nullptr) {}
+  EpochGuard(const EpochGuard &other) : counter_(other.counter_) {
+    if (counter_ != nullptr) counter_->fetch_add(1, std::memory_order_relaxed);
+  }
+  EpochGuard(EpochGuard &&other) : counter_(other.counter_) {
+    other.counter_ = nullptr;
+  }
+  EpochGuard &operator=(EpochGuard other) {
+    std::atomic<std::uint64_t> *tmp = counter_;
+    counter_ = other.counter_;
+    other.counter_ = tmp;
+    return *this;
+  }
+  ~EpochGuard() {
+    if (counter_ != nullptr) counter_->fetch_sub(1, std::memory_order_release);
+  }
+
+ private:
+  template <typename T, typename Free>
+  friend class EpochDomain;
+
+  explicit EpochGuard(std::atomic<std::uint64_t> *counter)
+      : counter_(counter) {}
+
+  std::atomic<std::uint64_t> *counter_;
+};
+
+// ========== КЛАСС ДОМЕНА ЭПОХ ========== //
+
+template <typename T, typename Free>
+class EpochDomain {
+ public:
+  EpochDomain() : epoch_(0), slots_() {}
+  EpochDomain(const EpochDomain &) = delete;
+  EpochDomain &operator=(const EpochDomain &) = delete;
+
+  // потоков внутри guard в момент удаления быть не должно
+  ~EpochDomain() {
+    for (Retired &item : retired_) Free()(item.ptr);
+  }
+
+  // Вход: счетчик увеличивается для текущей эпохи, и эпоха проверяется еще
+  // раз. Если ее успели сдвинуть, вход повторяется: либо сдвигающий поток
+  // увидит наш счетчик, либо мы - новую эпоху (обе операции seq_cst)
+  EpochGuard Pin() const {
+    Slot &slot = slots_[ThreadSlot()];
+    while (true) {
+      std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+      std::atomic<std::uint64_t> *counter = &slot.active[epoch & 1];
+      counter->fetch_add(1, std::memory_order_seq_cst);
+      if (epoch_.load(std::memory_order_seq_cst) == epoch) {
+        return EpochGuard(counter);
+      }
+      counter->fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+  // ptr уже недостижим для новых читателей; может бросить std::bad_alloc
+  void Retire(T *ptr) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    retired_.push_back({ptr, epoch_.load(std::memory_order_relaxed)});
+    if (retired_.size() >= kBatch) TryAdvance();
+  }
+
+  // место под count вызовов Retire(), чтобы они не бросали исключений
+  void Reserve(std::size_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    retired_.reserve(retired_.size() + count);
+  }
+
+ private:
+  // число слотов; поток берет слот по очереди при первом входе
+  static constexpr std::size_t kSlots = 64;
+  // сдвиг эпохи обходит все слоты, поэтому делается не чаще, чем раз в
+  // kBatch освобождений
+  static constexpr std::size_t kBatch = 32;
+
+  struct Retired {
+    T *ptr;
+    std::uint64_t epoch;  // эпоха, в которой объект стал недостижим
+  };
+
+  // счетчики потоков четной и нечетной эпохи, каждый слот на своей линии
+  struct alignas(64) Slot {
+    std::atomic<std::uint64_t> active[2];
+  };
+
+  static std::size_t ThreadSlot() {
+    static std::atomic<std::size_t> next_slot(0);
+    thread_local std::size_t slot =
+        next_slot.fetch_add(1, std::memory_order_relaxed) % kSlots;
+    return slot;
+  }
+
+  // Потоки эпохи E - 2 ушли при прошлом сдвиге. Если в слотах нет и потоков
+  // E - 1 (у них та же четность, что у E + 1), объекты, ставшие
+  // недостижимыми до E, никто не держит: они освобождаются, и эпоха
+  // сдвигается. Иначе ждать не нужно, попробует следующий Retire()
+  void TryAdvance() {
+    std::uint64_t epoch = epoch_.load(std::memory_order_relaxed);
+    for (Slot &slot : slots_) {
+      if (slot.active[(epoch + 1) & 1].load(std::memory_order_seq_cst) != 0) {
+        return;
+      }
+    }
+    std::size_t kept = 0;
+    for (Retired &item : retired_) {
+      if (item.epoch < epoch) {
+        Free()(item.ptr);
+      } else {
+        retired_[kept++] = item;
+      }
+    }
+    while (retired_.size() > kept) retired_.pop_back();
+    epoch_.store(epoch + 1, std::memory_order_seq_cst);
+  }
+
+  std::atomic<std::uint64_t> epoch_;
+  mutable Slot slots_[kSlots];
+  std::mutex mutex_;
+  Vector<Retired> retired_;  // под mutex_
+};
+
+}  // namespace s21
+
+#endif  // CPP2_SRC_EPOCH_H_
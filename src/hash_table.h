@@ -0,0 +1,485 @@
+#ifndef CPP2_SRC_HASH_TABLE_H_
+#define CPP2_SRC_HASH_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>  // для std::memcpy, std::memset
+#include <limits>   // для std::numeric_limits
+#include <type_traits>
+#include <utility>  // для std::pair, std::swap
+
+#include "pair_ref.h"
+
+namespace s21 {
+
+/**
+ * Хеш-таблица с открытой адресацией для unordered_map / unordered_set,
+ * устроена как SwissTable:
+ * - на каждую ячейку один управляющий байт: пусто, удалено или 7 младших
+ *   бит хеша (H2) занятой ячейки
+ * - ключи (и значения) лежат в отдельных массивах той же длины
+ * - поиск идет группами по 8 ячеек: 8 управляющих байт читаются как одно
+ *   64-битное слово, и кандидаты с тем же H2 находятся несколькими
+ *   битовыми операциями (SWAR), ключи сравниваются только у них
+ * - пустая ячейка в группе означает, что дальше ключ искать не нужно
+ *
+ * Здесь два класса:
+ * - HashTable
+ * - HashIterator
+ */
+
+// массив значений рядом с ключами; у множества (V = void) его нет
+template <typename V>
+struct HashValues {
+  V* vals = nullptr;
+};
+
+template <>
+struct HashValues<void> {};
+
+// ========== КЛАСС ХЕШ-ТАБЛИЦЫ ============== //
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+class HashTable : private HashValues<V> {
+ public:
+  // число ячеек в группе: управляющие байты группы - одно слово uint64_t
+  static constexpr size_t kGroup = 8;
+  // заполненность по умолчанию и наибольшая допустимая: хотя бы одна ячейка
+  // в таблице всегда остается пустой, иначе поиск не остановится
+  static constexpr float kDefaultMaxLoad = 0.875f;
+  static constexpr float kMaxLoadLimit = 0.9375f;
+
+  // КОНСТРУКТОРЫ И ДЕСТРУКТОРЫ
+  HashTable();
+  HashTable(const HashTable& other);
+  HashTable(HashTable&& other);
+  ~HashTable();
+
+  HashTable& operator=(HashTable&& other);
+
+  // ОСНОВНЫЕ ПУБЛИЧНЫЕ МЕТОДЫ
+  // вставка ключа, если его нет; возвращает <номер ячейки, была ли вставка>.
+  // Значение нового ключа - по умолчанию
+  std::pair<size_t, bool> Insert(const K& key);
+  // номер ячейки с ключом или Capacity(), если ключа нет
+  size_t Find(const K& key) const;
+  // удаление ключа, false если его не было
+  bool Remove(const K& key);
+  // удаление занятой ячейки i (на ее месте остается метка "удалено")
+  void EraseAt(size_t i);
+  // первая занятая ячейка с номером не меньше i или Capacity()
+  size_t Next(size_t i) const;
+
+  void Clear();
+  void Swap(HashTable& other);
+  // перестраивает таблицу так, чтобы в ней было не меньше count ячеек и
+  // Size() элементов помещались при MaxLoadFactor(); метки "удалено" исчезают
+  void Rehash(size_t count);
+  // место под n элементов без перестройки
+  void Reserve(size_t n);
+
+  float MaxLoadFactor() const { return max_load; }
+  void SetMaxLoadFactor(float factor);
+  float LoadFactor() const;
+  size_t MaxSize() const;
+
+  size_t Size() const { return size; }
+  size_t Capacity() const { return capacity; }
+  const K& Key(size_t i) const { return keys[i]; }
+  template <typename U = V>
+  const U& Value(size_t i) const {
+    return this->vals[i];
+  }
+  template <typename U = V>
+  U& Value(size_t i) {
+    return this->vals[i];
+  }
+
+ private:
+  // управляющие байты: пусто и удалено - с установленным старшим битом,
+  // у занятой ячейки старший бит 0
+  static constexpr int8_t kEmpty = -128;   // 0b10000000
+  static constexpr int8_t kDeleted = -2;   // 0b11111110
+  static constexpr uint64_t kLsbs = 0x0101010101010101ULL;
+  static constexpr uint64_t kMsbs = 0x8080808080808080ULL;
+
+  int8_t* ctrl;  // capacity + kGroup байт: первые kGroup повторены в конце,
+                 // чтобы группа у конца таблицы читалась без перехода
+  K* keys;
+  size_t capacity;  // степень двойки, не меньше kGroup (или 0)
+  size_t size;
+  size_t deleted;  // число меток "удалено"
+  float max_load;
+  Hash hasher;
+  KeyEqual equal;
+
+  // хеш перемешивается умножением: std::hash для целых - тождественная
+  // функция, а для H1 и H2 нужны разные и случайные на вид биты
+  size_t HashOf(const K& key) const;
+  static int8_t H2(size_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+
+  // 8 управляющих байт, начиная с pos, в одном слове (байт j - биты 8j..8j+7)
+  uint64_t Group(size_t pos) const;
+  // маски кандидатов в группе: старший бит байта j установлен для подходящих
+  static uint64_t Match(uint64_t group, int8_t h2);
+  static uint64_t MatchEmpty(uint64_t group);
+  static uint64_t MatchEmptyOrDeleted(uint64_t group);
+  // номер байта младшего установленного бита маски
+  static size_t FirstIndex(uint64_t mask);
+
+  // первая пустая или удаленная ячейка на пути поиска хеша
+  size_t FindFree(size_t hash) const;
+  void SetCtrl(size_t i, int8_t value);
+  // выделяет пустую таблицу на count ячеек и вставляет в нее старые элементы
+  void Resize(size_t count);
+  // число ячеек под n элементов при текущей заполненности
+  size_t CapacityFor(size_t n) const;
+  void Release();
+};
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+HashTable<K, V, Hash, KeyEqual>::HashTable()
+    : ctrl(nullptr),
+      keys(nullptr),
+      capacity(0),
+      size(0),
+      deleted(0),
+      max_load(kDefaultMaxLoad),
+      hasher(),
+      equal() {}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+HashTable<K, V, Hash, KeyEqual>::HashTable(const HashTable& other)
+    : HashTable() {
+  max_load = other.max_load;
+  hasher = other.hasher;
+  equal = other.equal;
+  if (other.capacity == 0) return;
+  capacity = other.capacity;
+  size = other.size;
+  deleted = other.deleted;
+  ctrl = new int8_t[capacity + kGroup];
+  std::memcpy(ctrl, other.ctrl, capacity + kGroup);
+  keys = new K[capacity]();
+  if constexpr (!std::is_void<V>::value) this->vals = new V[capacity]();
+  for (size_t i = other.Next(0); i < capacity; i = other.Next(i + 1)) {
+    keys[i] = other.keys[i];
+    if constexpr (!std::is_void<V>::value) this->vals[i] = other.vals[i];
+  }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+HashTable<K, V, Hash, KeyEqual>::HashTable(HashTable&& other) : HashTable() {
+  Swap(other);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+HashTable<K, V, Hash, KeyEqual>::~HashTable() {
+  Release();
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+HashTable<K, V, Hash, KeyEqual>& HashTable<K, V, Hash, KeyEqual>::operator=(
+    HashTable&& other) {
+  if (this != &other) {
+    Clear();
+    Swap(other);
+  }
+  return *this;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+std::pair<size_t, bool> HashTable<K, V, Hash, KeyEqual>::Insert(
+    const K& key) {
+  size_t found = Find(key);
+  if (found != capacity) return std::make_pair(found, false);
+
+  // место под новый элемент считается вместе с метками "удалено". Если живых
+  // элементов не больше половины допустимого, таблица забита в основном
+  // метками и перестраивается на месте, иначе растет вдвое
+  if (capacity == 0 || static_cast<float>(size + deleted + 1) >
+                           max_load * static_cast<float>(capacity)) {
+    size_t count = CapacityFor(size + 1);
+    if (count <= capacity) {
+      bool crowded = static_cast<float>(2 * size) >
+                     max_load * static_cast<float>(capacity);
+      count = crowded ? capacity * 2 : capacity;
+    }
+    Resize(count);
+  }
+  size_t hash = HashOf(key);
+  size_t i = FindFree(hash);
+  if (ctrl[i] == kDeleted) deleted--;
+  SetCtrl(i, H2(hash));
+  keys[i] = key;
+  size++;
+  return std::make_pair(i, true);
+}
+
+/**
+ * Поиск: группы по 8 ячеек начиная с H1 = hash >> 7, сдвиг между группами
+ * растет на kGroup (квадратичное пробирование по группам). При вместимости -
+ * степени двойки такой обход посещает все ячейки
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual>
+size_t HashTable<K, V, Hash, KeyEqual>::Find(const K& key) const {
+  if (capacity == 0) return capacity;
+  size_t hash = HashOf(key);
+  size_t mask = capacity - 1;
+  size_t pos = (hash >> 7) & mask;
+  for (size_t step = kGroup;; step += kGroup) {
+    uint64_t group = Group(pos);
+    for (uint64_t m = Match(group, H2(hash)); m != 0; m &= m - 1) {
+      size_t i = (pos + FirstIndex(m)) & mask;
+      if (equal(keys[i], key)) return i;
+    }
+    if (MatchEmpty(group) != 0) return capacity;
+    pos = (pos + step) & mask;
+  }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+size_t HashTable<K, V, Hash, KeyEqual>::FindFree(size_t hash) const {
+  size_t mask = capacity - 1;
+  size_t pos = (hash >> 7) & mask;
+  for (size_t step = kGroup;; step += kGroup) {
+    uint64_t m = MatchEmptyOrDeleted(Group(pos));
+    if (m != 0) return (pos + FirstIndex(m)) & mask;
+    pos = (pos + step) & mask;
+  }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+bool HashTable<K, V, Hash, KeyEqual>::Remove(const K& key) {
+  size_t i = Find(key);
+  if (i == capacity) return false;
+  EraseAt(i);
+  return true;
+}
+
+// ячейку нельзя пометить пустой: через нее могли пройти поиски других ключей.
+// Счетчики меняются до сброса ключа и значения: если присваивание бросит,
+// таблица все равно останется согласованной
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void HashTable<K, V, Hash, KeyEqual>::EraseAt(size_t i) {
+  SetCtrl(i, kDeleted);
+  size--;
+  deleted++;
+  keys[i] = K();
+  if constexpr (!std::is_void<V>::value) this->vals[i] = V();
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+size_t HashTable<K, V, Hash, KeyEqual>::Next(size_t i) const {
+  while (i < capacity && ctrl[i] < 0) i++;
+  return i;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void HashTable<K, V, Hash, KeyEqual>::Clear() {
+  Release();
+  ctrl = nullptr;
+  keys = nullptr;
+  if constexpr (!std::is_void<V>::value) this->vals = nullptr;
+  capacity = size = deleted = 0;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void HashTable<K, V, Hash, KeyEqual>::Swap(HashTable& other) {
+  std::swap(ctrl, other.ctrl);
+  std::swap(keys, other.keys);
+  if constexpr (!std::is_void<V>::value) std::swap(this->vals, other.vals);
+  std::swap(capacity, other.capacity);
+  std::swap(size, other.size);
+  std::swap(deleted, other.deleted);
+  std::swap(max_load, other.max_load);
+  std::swap(hasher, other.hasher);
+  std::swap(equal, other.equal);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void HashTable<K, V, Hash, KeyEqual>::Rehash(size_t count) {
+  size_t target = CapacityFor(size);
+  while (target < count) target *= 2;
+  if (size == 0 && count == 0) {
+    Clear();
+  } else {
+    Resize(target);
+  }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void HashTable<K, V, Hash, KeyEqual>::Reserve(size_t n) {
+  if (n > size && CapacityFor(n) > capacity) Resize(CapacityFor(n));
+}
+
+// заполненность вне (0, kMaxLoadLimit] приводится к границе; если таблица
+// уже заполнена сильнее, она сразу перестраивается
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void HashTable<K, V, Hash, KeyEqual>::SetMaxLoadFactor(float factor) {
+  if (!(factor > 0.0f)) factor = 0.125f;
+  if (factor > kMaxLoadLimit) factor = kMaxLoadLimit;
+  max_load = factor;
+  if (capacity != 0 && static_cast<float>(size + deleted) >
+                           max_load * static_cast<float>(capacity)) {
+    Resize(CapacityFor(size));
+  }
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+float HashTable<K, V, Hash, KeyEqual>::LoadFactor() const {
+  if (capacity == 0) return 0.0f;
+  return static_cast<float>(size) / static_cast<float>(capacity);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+size_t HashTable<K, V, Hash, KeyEqual>::MaxSize() const {
+  return std::numeric_limits<size_t>::max() / 2 / sizeof(K);
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+size_t HashTable<K, V, Hash, KeyEqual>::HashOf(const K& key) const {
+  uint64_t hash = static_cast<uint64_t>(hasher(key)) * 0x9E3779B97F4A7C15ULL;
+  return static_cast<size_t>(hash ^ (hash >> 32));
+}
+
+// байты собираются сдвигами, поэтому порядок байт платформы не важен;
+// компилятор сводит цикл к одному чтению слова
+template <typename K, typename V, typename Hash, typename KeyEqual>
+uint64_t HashTable<K, V, Hash, KeyEqual>::Group(size_t pos) const {
+  uint64_t group = 0;
+  for (size_t j = 0; j < kGroup; ++j) {
+    group |= static_cast<uint64_t>(static_cast<uint8_t>(ctrl[pos + j]))
+             << (8 * j);
+  }
+  return group;
+}
+
+// байты, равные h2, обращаются в ноль; классический поиск нулевого байта.
+// Бывают ложные срабатывания (байт h2 + 1 сразу после совпадения), их
+// отсеивает сравнение ключей
+template <typename K, typename V, typename Hash, typename KeyEqual>
+uint64_t HashTable<K, V, Hash, KeyEqual>::Match(uint64_t group, int8_t h2) {
+  uint64_t x = group ^ (kLsbs * static_cast<uint8_t>(h2));
+  return (x - kLsbs) & ~x & kMsbs;
+}
+
+// пусто (10000000) - единственный байт со старшим битом и нулевым битом 1
+template <typename K, typename V, typename Hash, typename KeyEqual>
+uint64_t HashTable<K, V, Hash, KeyEqual>::MatchEmpty(uint64_t group) {
+  return group & (~group << 6) & kMsbs;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+uint64_t HashTable<K, V, Hash, KeyEqual>::MatchEmptyOrDeleted(uint64_t group) {
+  return group & kMsbs;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+size_t HashTable<K, V, Hash, KeyEqual>::FirstIndex(uint64_t mask) {
+  return static_cast<size_t>(__builtin_ctzll(mask)) / 8;
+}
+
+// копия первых kGroup байт в конце массива поддерживается при каждой записи
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void HashTable<K, V, Hash, KeyEqual>::SetCtrl(size_t i, int8_t value) {
+  ctrl[i] = value;
+  if (i < kGroup) ctrl[capacity + i] = value;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void HashTable<K, V, Hash, KeyEqual>::Resize(size_t count) {
+  HashTable old;
+  Swap(old);
+  max_load = old.max_load;
+  hasher = old.hasher;
+  equal = old.equal;
+
+  capacity = count;
+  ctrl = new int8_t[capacity + kGroup];
+  std::memset(ctrl, static_cast<uint8_t>(kEmpty), capacity + kGroup);
+  keys = new K[capacity]();
+  if constexpr (!std::is_void<V>::value) this->vals = new V[capacity]();
+
+  for (size_t i = old.Next(0); i < old.capacity; i = old.Next(i + 1)) {
+    size_t hash = HashOf(old.keys[i]);
+    size_t j = FindFree(hash);
+    SetCtrl(j, H2(hash));
+    keys[j] = std::move(old.keys[i]);
+    if constexpr (!std::is_void<V>::value) {
+      this->vals[j] = std::move(old.vals[i]);
+    }
+  }
+  size = old.size;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+size_t HashTable<K, V, Hash, KeyEqual>::CapacityFor(size_t n) const {
+  size_t count = kGroup;
+  while (max_load * static_cast<float>(count) < static_cast<float>(n)) {
+    count *= 2;
+  }
+  return count;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual>
+void HashTable<K, V, Hash, KeyEqual>::Release() {
+  delete[] ctrl;
+  delete[] keys;
+  if constexpr (!std::is_void<V>::value) delete[] this->vals;
+}
+
+// ========== КЛАСС ИТЕРАТОР ========== //
+// Номер ячейки в таблице, end() - Capacity(). ++ пропускает пустые ячейки.
+// Порядок обхода не определен, вставка может перестроить таблицу и сделать
+// итераторы недействительными. Таблица не const: через итератор словаря
+// меняют значения
+template <typename K, typename V, typename Hash, typename KeyEqual>
+class HashIterator {
+ public:
+  size_t index_;
+  HashTable<K, V, Hash, KeyEqual>* table_;
+
+  HashIterator(size_t index, HashTable<K, V, Hash, KeyEqual>* table)
+      : index_(index), table_(table) {}
+
+  // у unordered_set - ключ, у unordered_map - пара ссылок на ключ и значение
+  using reference = typename ElementRef<K, V>::type;
+
+  reference operator*() const {
+    if constexpr (std::is_void<V>::value) {
+      return table_->Key(index_);
+    } else {
+      return reference(table_->Key(index_), table_->Value(index_));
+    }
+  }
+
+  // только для unordered_map
+  template <typename U = V>
+  PairArrow<K, U> operator->() const {
+    return PairArrow<K, U>(table_->Key(index_), table_->Value(index_));
+  }
+
+  HashIterator& operator++() {
+    index_ = table_->Next(index_ + 1);
+    return *this;
+  }
+
+  HashIterator operator++(int) {
+    HashIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  bool operator==(const HashIterator& other) const {
+    return index_ == other.index_;
+  }
+
+  bool operator!=(const HashIterator& other) const {
+    return index_ != other.index_;
+  }
+};  // end class HashIterator
+
+}  // namespace s21
+
+#endif  // CPP2_SRC_HASH_TABLE_H_
@@ -0,0 +1,44 @@
+#ifndef CPP2_SRC_PAIR_REF_H_
+#define CPP2_SRC_PAIR_REF_H_
+
+#include <utility>  // для std::pair
+
+namespace s21 {
+
+/**
+ * Доступ к элементу словаря, у которого ключи и значения лежат в разных
+ * массивах (flat_map, btree_map, unordered_map). Пары std::pair<const K, V>
+ * в памяти нет, поэтому *iter возвращает по значению пару ссылок
+ * PairRef<K, V>: (*iter).first - ключ, (*iter).second - значение, через
+ * него значение можно менять. iter-> возвращает PairArrow, который хранит
+ * такую пару внутри себя. У множеств тех же контейнеров (V = void) *iter -
+ * просто ключ, тип выбирает ElementRef
+ */
+
+template <typename K, typename V>
+using PairRef = std::pair<const K&, V&>;
+
+template <typename K, typename V>
+struct ElementRef {
+  using type = PairRef<K, V>;
+};
+
+template <typename K>
+struct ElementRef<K, void> {
+  using type = const K&;
+};
+
+template <typename K, typename V>
+class PairArrow {
+ public:
+  PairArrow(const K& key, V& value) : pair_(key, value) {}
+
+  const PairRef<K, V>* operator->() const { return &pair_; }
+
+ private:
+  PairRef<K, V> pair_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_SRC_PAIR_REF_H_
@@ -0,0 +1,461 @@
+#ifndef CPP2_SRC_PERSISTENT_TREE_H_
+#define CPP2_SRC_PERSISTENT_TREE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>  // для std::forward_iterator_tag
+#include <limits>    // для std::numeric_limits
+#include <tuple>     // для std::forward_as_tuple
+#include <utility>   // для std::pair
+
+namespace s21 {
+
+/**
+ * Персистентное дерево для persistent_map: снимок (копия дерева) - O(1),
+ * узлы общие у всех снимков, а запись копирует только путь от корня до
+ * изменяемого узла (path copying), O(log n) узлов.
+ * - узел хранит счетчик ссылок (сколько родителей и корней на него
+ *   указывает); счетчик атомарный, поэтому снимок можно отдать другому
+ *   потоку и освобождать там
+ * - узел со счетчиком 1 принадлежит только этому дереву и меняется на месте
+ *   (copy-on-write): пока снимков нет, запись не копирует ничего
+ * - общий узел не меняется никогда, поэтому обход снимка не пересекается с
+ *   записью в живое дерево и не требует блокировок
+ * Указателя на родителя нет (один узел может быть ребенком в нескольких
+ * версиях), поэтому балансировка рекурсивная - AVL по высотам поддеревьев,
+ * а итератор хранит путь от корня.
+ *
+ * Здесь три класса:
+ * - PersistentNode
+ * - PersistentTree
+ * - PersistentIterator
+ */
+
+// ========== КЛАСС УЗЛА ============== //
+
+template <typename T, typename V>
+class PersistentNode {
+ public:
+  std::pair<const T, V> value;  // ключ и значение
+  PersistentNode<T, V>* left;   // поддеревья: ссылки учтены в их refs
+  PersistentNode<T, V>* right;
+  std::atomic<size_t> refs;  // число ссылок на узел
+  int height;                // высота поддерева, лист - 1
+
+  template <typename... Args>
+  explicit PersistentNode(Args&&... args)
+      : value(std::forward<Args>(args)...),
+        left(nullptr),
+        right(nullptr),
+        refs(1),
+        height(1) {}
+};
+
+// ========== КЛАСС ДЕРЕВА ============== //
+
+// Ключи уникальные. Дерево владеет одной ссылкой на корень; копия дерева
+// берет еще одну ссылку на тот же корень. Изменять одно дерево из
+// нескольких потоков нельзя, но его снимки (копии) живут независимо
+template <typename T, typename V>
+class PersistentTree {
+ public:
+  using node_type = PersistentNode<T, V>;
+
+  // КОНСТРУКТОРЫ И ДЕСТРУКТОРЫ
+  PersistentTree();
+  PersistentTree(const PersistentTree& other);  // снимок, O(1)
+  PersistentTree(PersistentTree&& other);
+  ~PersistentTree();
+
+  PersistentTree& operator=(const PersistentTree& other);
+  PersistentTree& operator=(PersistentTree&& other);
+
+  // ОСНОВНЫЕ ПУБЛИЧНЫЕ МЕТОДЫ
+  // вставка ключа со значением V(args...), если его еще нет; при assign
+  // значение уже имеющегося ключа заменяется. Возвращает, была ли вставка
+  template <typename... Args>
+  bool Insert(const T& key, bool assign, Args&&... args);
+  // удаление ключа, возвращает false если ключа не было
+  bool Remove(const T& key);
+  const node_type* Search(const T& key) const;
+
+  void Clear();
+  void Swap(PersistentTree& other);
+  size_t MaxSize() const;
+
+  size_t GetSize() const { return size; }
+  const node_type* GetRoot() const { return root; }
+
+ private:
+  node_type* root;
+  size_t size;
+
+  static node_type* Retain(node_type* node);
+  // отпускает ссылку; последний владелец удаляет узел и отпускает детей
+  static void Release(node_type* node);
+  // Делает узел в slot изменяемым: общий узел заменяется копией. Ссылка на
+  // оригинал отпускается только после того, как копия записана в slot,
+  // поэтому исключение из копирования на любом шаге оставляет дерево
+  // целым: все ссылки учтены, уже сделанные копии равны оригиналам
+  static node_type* Unique(node_type*& slot);
+
+  // изменяют поддерево в slot на месте (slot - ссылка родителя или root)
+  template <typename... Args>
+  static void InsertInto(node_type*& slot, const T& key, bool assign,
+                         bool& inserted, Args&&... args);
+  static void RemoveFrom(node_type*& slot, const T& key);
+  // отцепляет минимальный узел поддерева без балансировки; depth -
+  // число узлов пути над ним
+  static node_type* DetachMin(node_type*& slot, int& depth);
+  // балансирует depth верхних узлов левой ветви снизу вверх
+  static void BalanceLeftPath(node_type*& slot, int depth);
+
+  static int Height(const node_type* node);
+  static void UpdateHeight(node_type* node);
+  static void RotateLeft(node_type*& slot);
+  static void RotateRight(node_type*& slot);
+  // восстанавливает |высота слева - высота справа| <= 1 в узле slot
+  static void Balance(node_type*& slot);
+};
+
+template <typename T, typename V>
+PersistentTree<T, V>::PersistentTree() : root(nullptr), size(0) {}
+
+template <typename T, typename V>
+PersistentTree<T, V>::PersistentTree(const PersistentTree& other)
+    : root(Retain(other.root)), size(other.size) {}
+
+template <typename T, typename V>
+PersistentTree<T, V>::PersistentTree(PersistentTree&& other)
+    : PersistentTree() {
+  Swap(other);
+}
+
+template <typename T, typename V>
+PersistentTree<T, V>::~PersistentTree() {
+  Release(root);
+}
+
+template <typename T, typename V>
+PersistentTree<T, V>& PersistentTree<T, V>::operator=(
+    const PersistentTree& other) {
+  if (this != &other) {
+    node_type* old = root;
+    root = Retain(other.root);
+    size = other.size;
+    Release(old);
+  }
+  return *this;
+}
+
+template <typename T, typename V>
+PersistentTree<T, V>& PersistentTree<T, V>::operator=(
+    PersistentTree&& other) {
+  if (this != &other) {
+    Clear();
+    Swap(other);
+  }
+  return *this;
+}
+
+// Существующий ключ без assign ищем заранее: иначе спуск скопировал бы
+// общий путь впустую. Исключение из копирования узла или из конструктора
+// значения оставляет содержимое прежним
+template <typename T, typename V>
+template <typename... Args>
+bool PersistentTree<T, V>::Insert(const T& key, bool assign, Args&&... args) {
+  if (!assign && Search(key) != nullptr) return false;
+  bool inserted = false;
+  InsertInto(root, key, assign, inserted, std::forward<Args>(args)...);
+  if (inserted) ++size;
+  return inserted;
+}
+
+// Исключение на спуске оставляет содержимое прежним. Когда узел уже
+// отцеплен, бросить может только копирование при повороте: ключ удален,
+// дерево целое, но балансировка выше этого места не выполнена
+template <typename T, typename V>
+bool PersistentTree<T, V>::Remove(const T& key) {
+  if (Search(key) == nullptr) return false;
+  try {
+    RemoveFrom(root, key);
+  } catch (...) {
+    if (Search(key) == nullptr) --size;
+    throw;
+  }
+  --size;
+  return true;
+}
+
+template <typename T, typename V>
+const PersistentNode<T, V>* PersistentTree<T, V>::Search(const T& key) const {
+  const node_type* node = root;
+  while (node != nullptr) {
+    if (key < node->value.first) {
+      node = node->left;
+    } else if (node->value.first < key) {
+      node = node->right;
+    } else {
+      return node;
+    }
+  }
+  return nullptr;
+}
+
+// узлы, общие со снимками, остаются им
+template <typename T, typename V>
+void PersistentTree<T, V>::Clear() {
+  Release(root);
+  root = nullptr;
+  size = 0;
+}
+
+template <typename T, typename V>
+void PersistentTree<T, V>::Swap(PersistentTree& other) {
+  std::swap(root, other.root);
+  std::swap(size, other.size);
+}
+
+template <typename T, typename V>
+size_t PersistentTree<T, V>::MaxSize() const {
+  return std::numeric_limits<size_t>::max() / 2 / sizeof(node_type);
+}
+
+template <typename T, typename V>
+PersistentNode<T, V>* PersistentTree<T, V>::Retain(node_type* node) {
+  if (node != nullptr) node->refs.fetch_add(1, std::memory_order_relaxed);
+  return node;
+}
+
+// acq_rel: все записи других владельцев в узел видны тому, кто его удаляет
+template <typename T, typename V>
+void PersistentTree<T, V>::Release(node_type* node) {
+  if (node == nullptr) return;
+  if (node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+  Release(node->left);
+  Release(node->right);
+  delete node;
+}
+
+// Узел со счетчиком 1 достижим только по пути, по которому мы пришли: все
+// узлы выше уже сделаны единственными (копия общего узла добавляет ссылку
+// каждому ребенку, поэтому ниже по пути копирование продолжается)
+template <typename T, typename V>
+PersistentNode<T, V>* PersistentTree<T, V>::Unique(node_type*& slot) {
+  node_type* node = slot;
+  if (node->refs.load(std::memory_order_acquire) == 1) return node;
+  node_type* copy = new node_type(node->value);
+  copy->left = Retain(node->left);
+  copy->right = Retain(node->right);
+  copy->height = node->height;
+  slot = copy;
+  Release(node);
+  return copy;
+}
+
+template <typename T, typename V>
+template <typename... Args>
+void PersistentTree<T, V>::InsertInto(node_type*& slot, const T& key,
+                                      bool assign, bool& inserted,
+                                      Args&&... args) {
+  if (slot == nullptr) {
+    slot = new node_type(std::piecewise_construct, std::forward_as_tuple(key),
+                         std::forward_as_tuple(std::forward<Args>(args)...));
+    inserted = true;
+    return;
+  }
+  node_type* node = Unique(slot);
+  if (key < node->value.first) {
+    InsertInto(node->left, key, assign, inserted,
+               std::forward<Args>(args)...);
+  } else if (node->value.first < key) {
+    InsertInto(node->right, key, assign, inserted,
+               std::forward<Args>(args)...);
+  } else {
+    node->value.second = V(std::forward<Args>(args)...);
+    return;
+  }
+  Balance(slot);
+}
+
+// ссылки на детей переходят от удаляемого узла к тому, кто встанет на его
+// место; минимальный узел правого поддерева сначала отцепляется, и только
+// потом поддеревья балансируются
+template <typename T, typename V>
+void PersistentTree<T, V>::RemoveFrom(node_type*& slot, const T& key) {
+  node_type* node = Unique(slot);
+  if (key < node->value.first) {
+    RemoveFrom(node->left, key);
+    Balance(slot);
+    return;
+  }
+  if (node->value.first < key) {
+    RemoveFrom(node->right, key);
+    Balance(slot);
+    return;
+  }
+  if (node->left == nullptr || node->right == nullptr) {
+    slot = node->left != nullptr ? node->left : node->right;
+    node->left = node->right = nullptr;
+    Release(node);
+    return;
+  }
+  int depth = 0;
+  node_type* min = DetachMin(node->right, depth);
+  min->left = node->left;
+  min->right = node->right;
+  node->left = node->right = nullptr;
+  slot = min;
+  Release(node);
+  BalanceLeftPath(min->right, depth);
+  Balance(slot);
+}
+
+template <typename T, typename V>
+PersistentNode<T, V>* PersistentTree<T, V>::DetachMin(node_type*& slot,
+                                                      int& depth) {
+  node_type* node = Unique(slot);
+  if (node->left == nullptr) {
+    slot = node->right;
+    node->right = nullptr;
+    return node;
+  }
+  ++depth;
+  return DetachMin(node->left, depth);
+}
+
+template <typename T, typename V>
+void PersistentTree<T, V>::BalanceLeftPath(node_type*& slot, int depth) {
+  if (depth == 0) return;
+  BalanceLeftPath(slot->left, depth - 1);
+  Balance(slot);
+}
+
+template <typename T, typename V>
+int PersistentTree<T, V>::Height(const node_type* node) {
+  return node == nullptr ? 0 : node->height;
+}
+
+template <typename T, typename V>
+void PersistentTree<T, V>::UpdateHeight(node_type* node) {
+  int left = Height(node->left);
+  int right = Height(node->right);
+  node->height = (left > right ? left : right) + 1;
+}
+
+// ребенок, который поднимается, копируется при необходимости; копии
+// записываются в slot и в node до любых других изменений
+template <typename T, typename V>
+void PersistentTree<T, V>::RotateLeft(node_type*& slot) {
+  node_type* node = Unique(slot);
+  node_type* child = Unique(node->right);
+  node->right = child->left;
+  child->left = node;
+  slot = child;
+  UpdateHeight(node);
+  UpdateHeight(child);
+}
+
+template <typename T, typename V>
+void PersistentTree<T, V>::RotateRight(node_type*& slot) {
+  node_type* node = Unique(slot);
+  node_type* child = Unique(node->left);
+  node->left = child->right;
+  child->right = node;
+  slot = child;
+  UpdateHeight(node);
+  UpdateHeight(child);
+}
+
+// узел в slot уже единственный
+template <typename T, typename V>
+void PersistentTree<T, V>::Balance(node_type*& slot) {
+  node_type* node = slot;
+  UpdateHeight(node);
+  int diff = Height(node->left) - Height(node->right);
+  if (diff > 1) {
+    if (Height(node->left->left) < Height(node->left->right)) {
+      RotateLeft(node->left);
+    }
+    RotateRight(slot);
+  } else if (diff < -1) {
+    if (Height(node->right->right) < Height(node->right->left)) {
+      RotateRight(node->right);
+    }
+    RotateLeft(slot);
+  }
+}
+
+// ========== КЛАСС ИТЕРАТОР ========== //
+
+// Путь от корня: в стеке узлы, в левом поддереве которых мы находимся, на
+// вершине - текущий узел; пустой стек - end(). Высота AVL-дерева из n узлов
+// меньше 1.45 * log2(n + 2), 64 уровней хватает на любой размер в памяти.
+// Итератор действителен, пока жива версия дерева, по которой он создан:
+// запись в дерево делает итераторы этого дерева недействительными, итераторы
+// снимков - нет
+template <typename T, typename V>
+class PersistentIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::pair<const T, V>;
+  using difference_type = std::ptrdiff_t;
+  using reference = const value_type&;
+  using pointer = const value_type*;
+
+  static constexpr int kMaxHeight = 64;
+
+  PersistentIterator() : path_(), depth_(0) {}
+
+  // первый узел поддерева root с ключом не меньше key; без key - begin()
+  explicit PersistentIterator(const PersistentNode<T, V>* root)
+      : path_(), depth_(0) {
+    PushLeft(root);
+  }
+  PersistentIterator(const PersistentNode<T, V>* root, const T& key)
+      : path_(), depth_(0) {
+    while (root != nullptr) {
+      if (root->value.first < key) {
+        root = root->right;
+      } else {
+        path_[depth_++] = root;
+        root = root->left;
+      }
+    }
+  }
+
+  reference operator*() const { return path_[depth_ - 1]->value; }
+  pointer operator->() const { return &path_[depth_ - 1]->value; }
+
+  PersistentIterator& operator++() {
+    const PersistentNode<T, V>* node = path_[--depth_];
+    PushLeft(node->right);
+    return *this;
+  }
+
+  PersistentIterator operator++(int) {
+    PersistentIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  bool operator==(const PersistentIterator& other) const {
+    if (depth_ == 0 || other.depth_ == 0) return depth_ == other.depth_;
+    return path_[depth_ - 1] == other.path_[other.depth_ - 1];
+  }
+  bool operator!=(const PersistentIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  void PushLeft(const PersistentNode<T, V>* node) {
+    for (; node != nullptr; node = node->left) path_[depth_++] = node;
+  }
+
+  const PersistentNode<T, V>* path_[kMaxHeight];
+  int depth_;
+};  // end class PersistentIterator
+
+}  // namespace s21
+
+#endif  // CPP2_SRC_PERSISTENT_TREE_H_
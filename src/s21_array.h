@@ -0,0 +1,141 @@
+#ifndef CPP2_SRC_S21_ARRAY_H_
+#define CPP2_SRC_S21_ARRAY_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+#include "stdexcept"
+
+namespace s21 {
+
+/*
+Fixed-size array that lives wherever the object lives (on the stack, inside
+another object) and never allocates. Every member function is constexpr, so
+lookup tables can be filled at compile time, and all special members are
+defaulted, so array<T, N> is trivially copyable whenever T is.
+ */
+template <typename T, std::size_t N>
+class array {
+ public:
+  // attributes
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = value_type *;
+  using const_iterator = const value_type *;
+  using size_type = std::size_t;
+
+  constexpr array() = default;
+
+  /*
+  Copies the items into the beginning of the array, the rest keeps the default
+  value. More than N items is an error.
+   */
+  constexpr array(std::initializer_list<value_type> const &items) : aArr() {
+    if (items.size() > N) {
+      throw std::out_of_range("s21::array: too many initializers");
+    }
+    size_type i = 0;
+    for (const_reference item : items) {
+      aArr[i++] = item;
+    }
+  }
+
+  constexpr array(const array &a) = default;
+  constexpr array(array &&a) noexcept = default;
+  ~array() = default;
+
+  constexpr array &operator=(const array &a) = default;
+  constexpr array &operator=(array &&a) noexcept = default;
+
+  /*
+  Returns a reference to the element at specified location pos, with bounds
+  checking. If pos is not within the range of the container, an exception of
+  type std::out_of_range is thrown.
+  */
+  constexpr reference at(size_type pos) {
+    if (pos >= N) throw std::out_of_range("Element is out of array!");
+    return aArr[pos];
+  }
+
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= N) throw std::out_of_range("Element is out of array!");
+    return aArr[pos];
+  }
+
+  /*
+  Returns a reference to the element at specified location pos. No bounds
+  checking is performed.
+  */
+  constexpr reference operator[](size_type pos) { return aArr[pos]; }
+
+  constexpr const_reference operator[](size_type pos) const {
+    return aArr[pos];
+  }
+
+  /*
+  Returns a reference to the first element in the container.
+  Calling front on an empty container causes undefined behavior.
+   */
+  constexpr reference front() { return aArr[0]; }
+
+  constexpr const_reference front() const { return aArr[0]; }
+
+  /*
+  Returns a reference to the last element in the container.
+  Calling back on an empty container causes undefined behavior.
+   */
+  constexpr reference back() { return aArr[N - 1]; }
+
+  constexpr const_reference back() const { return aArr[N - 1]; }
+
+  /*
+  Returns pointer to the underlying array serving as element storage.
+   */
+  constexpr iterator data() noexcept { return aArr; }
+
+  constexpr const_iterator data() const noexcept { return aArr; }
+
+  constexpr iterator begin() noexcept { return aArr; }
+
+  constexpr const_iterator begin() const noexcept { return aArr; }
+
+  constexpr iterator end() noexcept { return aArr + N; }
+
+  constexpr const_iterator end() const noexcept { return aArr + N; }
+
+  constexpr bool empty() const noexcept { return N == 0; }
+
+  constexpr size_type size() const noexcept { return N; }
+
+  constexpr size_type max_size() const noexcept { return N; }
+
+  /*
+  Exchanges the contents element by element (unlike the other containers
+  there is no buffer to swap), O(N).
+   */
+  constexpr void swap(array &other) {
+    for (size_type i = 0; i < N; ++i) {
+      value_type tmp = std::move(aArr[i]);
+      aArr[i] = std::move(other.aArr[i]);
+      other.aArr[i] = std::move(tmp);
+    }
+  }
+
+  /*
+  Assigns the given value to all elements in the container.
+   */
+  constexpr void fill(const_reference value) {
+    for (size_type i = 0; i < N; ++i) {
+      aArr[i] = value;
+    }
+  }
+
+ private:
+  // при N == 0 массив из одного элемента, чтобы не было массива нулевой длины
+  value_type aArr[N == 0 ? 1 : N]{};
+};
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_ARRAY_H_
@@ -0,0 +1,155 @@
+#ifndef CPP2_SRC_S21_BTREE_MAP_H_
+#define CPP2_SRC_S21_BTREE_MAP_H_
+
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>  // для std::pair
+
+#include "btree.h"
+
+namespace s21 {
+
+/*
+Ordered dictionary with the s21::map interface, stored in a B+ tree: up to
+BTreeSlots<Key>() keys per node in one array, values next to them in the
+leaf. For small keys this takes several times less memory than the
+one-node-per-key s21::map and touches far fewer cache lines per lookup.
+Unlike s21::map, insert and erase invalidate iterators.
+ */
+template <typename Key, typename T>
+class btree_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using tree_type = BTree<key_type, mapped_type>;
+  using iterator = BTreeIterator<key_type, mapped_type>;
+  using const_iterator = BTreeIterator<key_type, mapped_type>;
+  using size_type = std::size_t;
+
+  btree_map() : tree_() {}
+
+  btree_map(std::initializer_list<value_type> const &items) : btree_map() {
+    for (const_reference item : items) insert(item);
+  }
+
+  btree_map(const btree_map &other) : tree_(other.tree_) {}
+  btree_map(btree_map &&other) : tree_(std::move(other.tree_)) {}
+
+  ~btree_map() {}
+
+  btree_map &operator=(btree_map &&other) {
+    tree_ = std::move(other.tree_);
+    return *this;
+  }
+
+  // element access
+
+  mapped_type &at(const key_type &key) {
+    auto pos = tree_.Search(key);
+    if (pos.first == nullptr) {
+      throw std::out_of_range("s21::btree_map::at: out_of_range");
+    }
+    return pos.first->vals[pos.second];
+  }
+
+  // вставляет ключ со значением по умолчанию, если его нет
+  mapped_type &operator[](const key_type &key) {
+    auto r = tree_.Insert(key);
+    return r.first.first->vals[r.first.second];
+  }
+
+  // iterators
+
+  iterator begin() { return iterator(tree_.GetFirst(), 0, &tree_); }
+
+  iterator end() { return iterator(nullptr, 0, &tree_); }
+
+  // capacity
+
+  bool empty() { return tree_.GetSize() == 0; }
+
+  size_type size() { return tree_.GetSize(); }
+
+  size_type max_size() { return tree_.MaxSize(); }
+
+  // modifiers
+
+  void clear() { tree_.Clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    auto r = tree_.Insert(value.first);
+    if (r.second) {
+      r.first.first->vals[r.first.second] = value.second;
+    }
+    return std::make_pair(ToIterator(r.first), r.second);
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return insert(value_type(key, obj));
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    auto r = tree_.Insert(key);
+    r.first.first->vals[r.first.second] = obj;
+    return std::make_pair(ToIterator(r.first), true);
+  }
+
+  void erase(iterator pos) {
+    if (pos.leaf_ != nullptr) {
+      tree_.Remove(pos->first);
+    }
+  }
+
+  void swap(btree_map &other) { tree_.Swap(other.tree_); }
+
+  // like s21::map::merge: elements of other whose keys are not here move
+  // here, the rest stay in other. Values are moved, not copied; other is
+  // rebuilt from the elements that stay
+  void merge(btree_map &other) {
+    if (this == &other) return;
+    tree_type rest;
+    for (iterator iter = other.begin(); iter != other.end(); ++iter) {
+      auto r = tree_.Insert(iter->first);
+      if (!r.second) r = rest.Insert(iter->first);
+      r.first.first->vals[r.first.second] = std::move(iter->second);
+    }
+    other.tree_.Swap(rest);
+  }
+
+  // lookup
+
+  iterator find(const key_type &key) { return ToIterator(tree_.Search(key)); }
+
+  bool contains(const key_type &key) {
+    return tree_.Search(key).first != nullptr;
+  }
+
+  iterator lower_bound(const key_type &key) {
+    return ToIterator(tree_.LowerBound(key));
+  }
+
+  iterator upper_bound(const key_type &key) {
+    return ToIterator(tree_.UpperBound(key));
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+  tree_type &GetTree() { return tree_; }
+
+ private:
+  tree_type tree_;
+
+  iterator ToIterator(std::pair<typename tree_type::leaf_type *, size_t> pos) {
+    return iterator(pos.first, pos.second, &tree_);
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_BTREE_MAP_H_
@@ -0,0 +1,118 @@
+#ifndef CPP2_SRC_S21_BTREE_SET_H_
+#define CPP2_SRC_S21_BTREE_SET_H_
+
+#include <initializer_list>
+#include <utility>  // для std::pair
+
+#include "btree.h"
+
+namespace s21 {
+
+/*
+Ordered set with the s21::set interface, stored in a B+ tree. Leaves hold
+only keys (no value array), so a set of ints costs a few bytes per element
+instead of a 40-byte tree node. Unlike s21::set, insert and erase invalidate
+iterators.
+ */
+template <typename Key>
+class btree_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using tree_type = BTree<key_type, void>;
+  using iterator = BTreeIterator<key_type, void>;
+  using const_iterator = BTreeIterator<key_type, void>;
+  using size_type = std::size_t;
+
+  btree_set() : tree_() {}
+
+  btree_set(std::initializer_list<value_type> const &items) : btree_set() {
+    for (const_reference item : items) insert(item);
+  }
+
+  btree_set(const btree_set &other) : tree_(other.tree_) {}
+  btree_set(btree_set &&other) : tree_(std::move(other.tree_)) {}
+
+  ~btree_set() {}
+
+  btree_set &operator=(btree_set &&other) {
+    tree_ = std::move(other.tree_);
+    return *this;
+  }
+
+  // iterators
+
+  iterator begin() { return iterator(tree_.GetFirst(), 0, &tree_); }
+
+  iterator end() { return iterator(nullptr, 0, &tree_); }
+
+  // capacity
+
+  bool empty() { return tree_.GetSize() == 0; }
+
+  size_type size() { return tree_.GetSize(); }
+
+  size_type max_size() { return tree_.MaxSize(); }
+
+  // modifiers
+
+  void clear() { tree_.Clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    auto r = tree_.Insert(value);
+    return std::make_pair(ToIterator(r.first), r.second);
+  }
+
+  void erase(iterator pos) {
+    if (pos.leaf_ != nullptr) {
+      tree_.Remove(*pos);
+    }
+  }
+
+  void swap(btree_set &other) { tree_.Swap(other.tree_); }
+
+  // like s21::set::merge: keys of other that are not here move here, the
+  // rest stay in other
+  void merge(btree_set &other) {
+    if (this == &other) return;
+    tree_type rest;
+    for (iterator iter = other.begin(); iter != other.end(); ++iter) {
+      if (!tree_.Insert(*iter).second) rest.Insert(*iter);
+    }
+    other.tree_.Swap(rest);
+  }
+
+  // lookup
+
+  iterator find(const key_type &key) { return ToIterator(tree_.Search(key)); }
+
+  bool contains(const key_type &key) {
+    return tree_.Search(key).first != nullptr;
+  }
+
+  iterator lower_bound(const key_type &key) {
+    return ToIterator(tree_.LowerBound(key));
+  }
+
+  iterator upper_bound(const key_type &key) {
+    return ToIterator(tree_.UpperBound(key));
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+  tree_type &GetTree() { return tree_; }
+
+ private:
+  tree_type tree_;
+
+  iterator ToIterator(std::pair<typename tree_type::leaf_type *, size_t> pos) {
+    return iterator(pos.first, pos.second, &tree_);
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_BTREE_SET_H_
@@ -0,0 +1,166 @@
+#ifndef CPP2_SRC_S21_CONCURRENT_MAP_H_
+#define CPP2_SRC_S21_CONCURRENT_MAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // для std::hash
+#include <mutex>
+
+#include "s21_unordered_map.h"
+
+namespace s21 {
+
+/*
+Map for write-heavy workloads from many threads. Keys are split by hash
+over Shards independent shards, each a Shard container with its own mutex;
+threads working on different shards do not wait for each other. Every shard
+with its lock sits on its own cache lines, so locking one shard does not
+invalidate the line of a neighbour.
+
+Shard is unordered_map by default; s21::map<Key, T> keeps the keys of each
+shard ordered. No element reference escapes a lock: find() and update()
+pass the element to a visitor that runs while the shard is locked, and
+for_each() visits the shards one after another, so it sees each shard
+consistently but not the whole map at one moment. Visitors must not call
+back into the same map.
+ */
+template <typename Key, typename T, std::size_t Shards = 16,
+          typename Shard = unordered_map<Key, T>,
+          typename Hash = std::hash<Key>>
+class concurrent_map {
+  static_assert(Shards != 0 && (Shards & (Shards - 1)) == 0,
+                "s21::concurrent_map: Shards must be a power of two");
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using shard_type = Shard;
+  using size_type = std::size_t;
+
+  concurrent_map() : shards_() {}
+
+  concurrent_map(const concurrent_map &) = delete;
+  concurrent_map &operator=(const concurrent_map &) = delete;
+
+  static constexpr size_type shard_count() { return Shards; }
+
+  // modifiers
+
+  bool insert(const key_type &key, const mapped_type &obj) {
+    Part &part = PartOf(key);
+    std::lock_guard<std::mutex> lock(part.mutex);
+    return part.map.insert(key, obj).second;
+  }
+
+  // true, если ключа не было (insert_or_assign шардов всегда дает true)
+  bool insert_or_assign(const key_type &key, const mapped_type &obj) {
+    Part &part = PartOf(key);
+    std::lock_guard<std::mutex> lock(part.mutex);
+    auto result = part.map.insert(key, obj);
+    if (!result.second) result.first->second = obj;
+    return result.second;
+  }
+
+  size_type erase(const key_type &key) {
+    Part &part = PartOf(key);
+    std::lock_guard<std::mutex> lock(part.mutex);
+    return part.map.erase(key);
+  }
+
+  // visit(mapped_type &) для значения key, вставленного как init, если
+  // ключа не было: чтение-изменение-запись под одной блокировкой.
+  // Возвращает true, если элемент вставлен
+  template <typename Visitor>
+  bool update(const key_type &key, const mapped_type &init, Visitor visit) {
+    Part &part = PartOf(key);
+    std::lock_guard<std::mutex> lock(part.mutex);
+    auto result = part.map.insert(key, init);
+    visit(result.first->second);
+    return result.second;
+  }
+
+  void clear() {
+    for (Part &part : shards_) {
+      std::lock_guard<std::mutex> lock(part.mutex);
+      part.map.clear();
+    }
+  }
+
+  // lookup
+
+  // visit(const mapped_type &) под блокировкой шарда, если ключ есть
+  template <typename Visitor>
+  bool find(const key_type &key, Visitor visit) {
+    Part &part = PartOf(key);
+    std::lock_guard<std::mutex> lock(part.mutex);
+    auto pos = part.map.find(key);
+    if (pos == part.map.end()) return false;
+    const mapped_type &value = pos->second;
+    visit(value);
+    return true;
+  }
+
+  bool contains(const key_type &key) {
+    Part &part = PartOf(key);
+    std::lock_guard<std::mutex> lock(part.mutex);
+    return part.map.contains(key);
+  }
+
+  // сумма размеров шардов; при параллельных записях - примерная
+  size_type size() {
+    size_type total = 0;
+    for (Part &part : shards_) {
+      std::lock_guard<std::mutex> lock(part.mutex);
+      total += part.map.size();
+    }
+    return total;
+  }
+
+  bool empty() { return size() == 0; }
+
+  // visit(const key_type &, mapped_type &) для каждого элемента, шард за
+  // шардом; порядок - внутри шарда, если Shard упорядочен
+  template <typename Visitor>
+  void for_each(Visitor visit) {
+    for (Part &part : shards_) {
+      std::lock_guard<std::mutex> lock(part.mutex);
+      for (auto pos = part.map.begin(); pos != part.map.end(); ++pos) {
+        visit(pos->first, pos->second);
+      }
+    }
+  }
+
+ private:
+  // шард и его мьютекс на отдельных кэш-линиях
+  struct alignas(64) Part {
+    std::mutex mutex;
+    Shard map;
+  };
+
+  // шард выбирают старшие биты хеша, умноженного на нечетную константу:
+  // младшие биты std::hash целых - сам ключ, а unordered_map внутри шарда
+  // перемешивает хеш своей константой
+  static size_type ShardOf(const key_type &key) {
+    if constexpr (Shards == 1) {
+      return 0;
+    } else {
+      std::uint64_t hash =
+          static_cast<std::uint64_t>(Hash()(key)) * 0xBF58476D1CE4E5B9ULL;
+      return static_cast<size_type>(hash >> (64 - kShardBits));
+    }
+  }
+
+  Part &PartOf(const key_type &key) { return shards_[ShardOf(key)]; }
+
+  static constexpr int Log2(std::size_t value) {
+    return value <= 1 ? 0 : 1 + Log2(value / 2);
+  }
+
+  static constexpr int kShardBits = Log2(Shards);
+
+  Part shards_[Shards];
+};
+
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_CONCURRENT_MAP_H_
@@ -0,0 +1,403 @@
+#ifndef CPP2_SRC_S21_CONCURRENT_SKIP_MAP_H_
+#define CPP2_SRC_S21_CONCURRENT_SKIP_MAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <new>      // для std::launder
+#include <thread>   // для std::this_thread::yield
+#include <utility>  // для std::pair
+
+#include "epoch.h"
+
+namespace s21 {
+
+/*
+Ordered map for concurrent inserts, erases, lookups and range scans from
+many threads without a global lock. It is a lazy skip list (Herlihy, Lev,
+Luchangco and Shavit): an insert or erase locks only the predecessors of
+the key on each level, and lookups and iteration take no locks at all. An
+erase first marks the node, which removes it logically, and then unlinks it
+level by level. Unlinked nodes are freed through an EpochDomain (epoch.h)
+once no thread can still reach them.
+
+Iterators can be held and advanced while other threads modify the map. An
+iterator pins the nodes it can reach, so a long-lived iterator delays
+freeing memory. Iteration visits keys in order, skipping keys that are
+erased before it reaches them. Values are immutable after the insert, and
+size() is exact only when no writes are running. The s21::map members that
+hand out mutable references (at, operator[], insert_or_assign) are left out.
+ */
+template <typename Key, typename T>
+class concurrent_skip_map {
+  struct Node;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+
+  class iterator {
+   public:
+    iterator() : node_(nullptr) {}
+
+    reference operator*() const { return node_->value(); }
+    const value_type *operator->() const { return &node_->value(); }
+
+    iterator &operator++() {
+      node_ = concurrent_skip_map::SkipDead(
+          node_->next()[0].load(std::memory_order_acquire));
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    bool operator==(const iterator &other) const {
+      return node_ == other.node_;
+    }
+    bool operator!=(const iterator &other) const {
+      return node_ != other.node_;
+    }
+
+   private:
+    friend class concurrent_skip_map;
+
+    iterator(Node *node, EpochGuard guard)
+        : node_(node), guard_(std::move(guard)) {}
+
+    Node *node_;        // nullptr - end()
+    EpochGuard guard_;  // узлы, достижимые из node_, не освобождаются
+  };
+
+  using const_iterator = iterator;
+
+  concurrent_skip_map() : head_(NewNode(kMaxLevel)), size_(0) {
+    head_->linked.store(true, std::memory_order_relaxed);
+  }
+
+  concurrent_skip_map(std::initializer_list<value_type> const &items)
+      : concurrent_skip_map() {
+    for (const_reference item : items) insert(item);
+  }
+
+  concurrent_skip_map(const concurrent_skip_map &) = delete;
+  concurrent_skip_map &operator=(const concurrent_skip_map &) = delete;
+
+  // других потоков и итераторов в момент удаления быть не должно
+  ~concurrent_skip_map() {
+    Node *node = head_->next()[0].load(std::memory_order_relaxed);
+    while (node != nullptr) {
+      Node *next = node->next()[0].load(std::memory_order_relaxed);
+      FreeNode()(node);
+      node = next;
+    }
+    DeleteNode(head_);
+  }
+
+  // iterators
+
+  iterator begin() const {
+    EpochGuard guard = domain_.Pin();
+    Node *first = SkipDead(head_->next()[0].load(std::memory_order_acquire));
+    return iterator(first, std::move(guard));
+  }
+
+  iterator end() const { return iterator(); }
+
+  // capacity
+
+  bool empty() const { return size() == 0; }
+
+  size_type size() const { return size_.load(std::memory_order_relaxed); }
+
+  // modifiers
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj);
+
+  // возвращает число удаленных элементов (0 или 1)
+  size_type erase(const key_type &key);
+
+  // удаляет ключи по одному, можно вызывать параллельно с другими потоками
+  void clear() {
+    for (iterator pos = begin(); pos != end(); ++pos) erase(pos->first);
+  }
+
+  // lookup
+
+  iterator find(const key_type &key) const {
+    iterator pos = lower_bound(key);
+    return pos != end() && !(key < pos->first) ? pos : end();
+  }
+
+  bool contains(const key_type &key) const { return find(key) != end(); }
+
+  // первый элемент с ключом не меньше key (или end())
+  iterator lower_bound(const key_type &key) const {
+    EpochGuard guard = domain_.Pin();
+    Node *node = head_;
+    Node *next = nullptr;
+    for (int level = kMaxLevel - 1; level >= 0; --level) {
+      next = node->next()[level].load(std::memory_order_acquire);
+      while (next != nullptr && next->value().first < key) {
+        node = next;
+        next = node->next()[level].load(std::memory_order_acquire);
+      }
+    }
+    return iterator(SkipDead(next), std::move(guard));
+  }
+
+ private:
+  // уровней не больше kMaxLevel, узел получает следующий с вероятностью
+  // 1/4: хватает на 4^16 элементов
+  static constexpr int kMaxLevel = 16;
+
+  // Узел и его массив next[level] - один блок памяти. Ключ и значение
+  // строятся отдельно: у головы их нет
+  struct Node {
+    std::mutex lock;
+    std::atomic<bool> marked;  // логически удален
+    std::atomic<bool> linked;  // вставлен на всех уровнях
+    int level;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+    value_type &value() {
+      return *std::launder(reinterpret_cast<value_type *>(storage));
+    }
+    std::atomic<Node *> *next() {
+      return reinterpret_cast<std::atomic<Node *> *>(this + 1);
+    }
+  };
+
+  struct FreeNode {
+    void operator()(Node *node) const {
+      node->value().~value_type();
+      DeleteNode(node);
+    }
+  };
+
+  // блокировки предшественников на уровнях снизу вверх. Предшественник
+  // нижнего уровня не меньше верхнего, поэтому все потоки берут узлы в
+  // порядке убывания ключей, и повторяется только предыдущий узел
+  class PredLocks {
+   public:
+    PredLocks() : count_(0) {}
+    PredLocks(const PredLocks &) = delete;
+    PredLocks &operator=(const PredLocks &) = delete;
+    ~PredLocks() {
+      for (int i = 0; i < count_; ++i) nodes_[i]->lock.unlock();
+    }
+
+    void Lock(Node *node) {
+      if (count_ > 0 && nodes_[count_ - 1] == node) return;
+      node->lock.lock();
+      nodes_[count_++] = node;
+    }
+
+   private:
+    Node *nodes_[kMaxLevel];
+    int count_;
+  };
+
+  static Node *NewNode(int level) {
+    void *raw =
+        ::operator new(sizeof(Node) + level * sizeof(std::atomic<Node *>));
+    Node *node = new (raw) Node;
+    node->marked.store(false, std::memory_order_relaxed);
+    node->linked.store(false, std::memory_order_relaxed);
+    node->level = level;
+    for (int i = 0; i < level; ++i) {
+      new (&node->next()[i]) std::atomic<Node *>(nullptr);
+    }
+    return node;
+  }
+
+  static void DeleteNode(Node *node) {
+    node->~Node();
+    ::operator delete(node);
+  }
+
+  static Node *NewNode(int level, const key_type &key,
+                       const mapped_type &obj) {
+    Node *node = NewNode(level);
+    try {
+      new (node->storage) value_type(key, obj);
+    } catch (...) {
+      DeleteNode(node);
+      throw;
+    }
+    return node;
+  }
+
+  // уровень нового узла: 1 + число подряд идущих пар нулевых бит
+  static int RandomLevel() {
+    thread_local std::uint64_t state =
+        0x9E3779B97F4A7C15ULL ^ reinterpret_cast<std::uintptr_t>(&state);
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    int level = 1;
+    for (std::uint64_t bits = state; level < kMaxLevel && (bits & 3) == 0;
+         bits >>= 2) {
+      ++level;
+    }
+    return level;
+  }
+
+  // первый живой узел, начиная с node: вставленный и не удаленный
+  static Node *SkipDead(Node *node) {
+    while (node != nullptr &&
+           (!node->linked.load(std::memory_order_acquire) ||
+            node->marked.load(std::memory_order_acquire))) {
+      node = node->next()[0].load(std::memory_order_acquire);
+    }
+    return node;
+  }
+
+  // предшественники и преемники key на всех уровнях; возвращает верхний
+  // уровень, где найден узел с ключом key, или -1
+  int Find(const key_type &key, Node **preds, Node **succs) const;
+
+  Node *head_;
+  std::atomic<size_type> size_;
+  EpochDomain<Node, FreeNode> domain_;
+};
+
+template <typename Key, typename T>
+int concurrent_skip_map<Key, T>::Find(const key_type &key, Node **preds,
+                                      Node **succs) const {
+  int found = -1;
+  Node *pred = head_;
+  for (int level = kMaxLevel - 1; level >= 0; --level) {
+    Node *curr = pred->next()[level].load(std::memory_order_acquire);
+    while (curr != nullptr && curr->value().first < key) {
+      pred = curr;
+      curr = pred->next()[level].load(std::memory_order_acquire);
+    }
+    if (found == -1 && curr != nullptr && !(key < curr->value().first)) {
+      found = level;
+    }
+    preds[level] = pred;
+    succs[level] = curr;
+  }
+  return found;
+}
+
+// Узел связывается снизу вверх под блокировками предшественников, которые
+// проверены: не удалены и все еще указывают на преемников. Если ключ есть,
+// но узел помечен, ждем, пока удаляющий поток его отцепит
+template <typename Key, typename T>
+std::pair<typename concurrent_skip_map<Key, T>::iterator, bool>
+concurrent_skip_map<Key, T>::insert(const key_type &key,
+                                    const mapped_type &obj) {
+  EpochGuard guard = domain_.Pin();
+  int top = RandomLevel();
+  Node *preds[kMaxLevel];
+  Node *succs[kMaxLevel];
+  while (true) {
+    int found = Find(key, preds, succs);
+    if (found != -1) {
+      Node *node = succs[found];
+      if (!node->marked.load(std::memory_order_acquire)) {
+        while (!node->linked.load(std::memory_order_acquire)) {
+          std::this_thread::yield();
+        }
+        return std::make_pair(iterator(node, std::move(guard)), false);
+      }
+      std::this_thread::yield();
+      continue;
+    }
+    PredLocks locks;
+    bool valid = true;
+    for (int level = 0; valid && level < top; ++level) {
+      Node *pred = preds[level];
+      Node *succ = succs[level];
+      locks.Lock(pred);
+      valid = !pred->marked.load(std::memory_order_acquire) &&
+              (succ == nullptr ||
+               !succ->marked.load(std::memory_order_acquire)) &&
+              pred->next()[level].load(std::memory_order_acquire) == succ;
+    }
+    if (!valid) continue;
+    Node *node = NewNode(top, key, obj);
+    for (int level = 0; level < top; ++level) {
+      node->next()[level].store(succs[level], std::memory_order_relaxed);
+    }
+    for (int level = 0; level < top; ++level) {
+      preds[level]->next()[level].store(node, std::memory_order_release);
+    }
+    node->linked.store(true, std::memory_order_release);
+    size_.fetch_add(1, std::memory_order_relaxed);
+    return std::make_pair(iterator(node, std::move(guard)), true);
+  }
+}
+
+// Удаляет тот, кто пометил узел под его блокировкой. Узел держится
+// заблокированным, пока не проверены предшественники, затем отцепляется
+// сверху вниз и отдается домену эпох
+template <typename Key, typename T>
+typename concurrent_skip_map<Key, T>::size_type
+concurrent_skip_map<Key, T>::erase(const key_type &key) {
+  EpochGuard guard = domain_.Pin();
+  Node *victim = nullptr;
+  bool is_marked = false;
+  Node *preds[kMaxLevel];
+  Node *succs[kMaxLevel];
+  while (true) {
+    int found = Find(key, preds, succs);
+    if (!is_marked) {
+      // удалять можно только вставленный на всех уровнях и не помеченный
+      if (found == -1) return 0;
+      victim = succs[found];
+      if (!victim->linked.load(std::memory_order_acquire) ||
+          victim->level - 1 != found ||
+          victim->marked.load(std::memory_order_acquire)) {
+        return 0;
+      }
+      victim->lock.lock();
+      if (victim->marked.load(std::memory_order_relaxed)) {
+        victim->lock.unlock();
+        return 0;
+      }
+      victim->marked.store(true, std::memory_order_release);
+      is_marked = true;
+    }
+    {
+      PredLocks locks;
+      bool valid = true;
+      for (int level = 0; valid && level < victim->level; ++level) {
+        Node *pred = preds[level];
+        locks.Lock(pred);
+        valid = !pred->marked.load(std::memory_order_acquire) &&
+                pred->next()[level].load(std::memory_order_acquire) == victim;
+      }
+      if (!valid) continue;
+      for (int level = victim->level - 1; level >= 0; --level) {
+        preds[level]->next()[level].store(
+            victim->next()[level].load(std::memory_order_relaxed),
+            std::memory_order_release);
+      }
+      victim->lock.unlock();
+    }
+    size_.fetch_sub(1, std::memory_order_relaxed);
+    domain_.Retire(victim);
+    return 1;
+  }
+}
+
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_CONCURRENT_SKIP_MAP_H_
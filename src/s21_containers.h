@@ -1,8 +1,11 @@
 #ifndef CPP2_S21_CONTAINERS_1_MASTER_S21_CONTAINERS_H
 #define CPP2_S21_CONTAINERS_1_MASTER_S21_CONTAINERS_H
 
+#include "s21_deque.h"
+#include "s21_indexed_priority_queue.h"
 #include "s21_list.h"
 #include "s21_map.h"
+#include "s21_priority_queue.h"
 #include "s21_queue.h"
 #include "s21_set.h"
 #include "s21_stack.h"
@@ -0,0 +1,17 @@
+#ifndef CPP2_S21_CONTAINERS_1_MASTER_S21_CONTAINERSPLUS_H
+#define CPP2_S21_CONTAINERS_1_MASTER_S21_CONTAINERSPLUS_H
+
+#include "s21_array.h"
+#include "s21_btree_map.h"
+#include "s21_btree_set.h"
+#include "s21_concurrent_map.h"
+#include "s21_concurrent_skip_map.h"
+#include "s21_flat_map.h"
+#include "s21_flat_set.h"
+#include "s21_multiset.h"
+#include "s21_persistent_map.h"
+#include "s21_rcu_map.h"
+#include "s21_unordered_map.h"
+#include "s21_unordered_set.h"
+
+#endif  // CPP2_S21_CONTAINERS_1_MASTER_S21_CONTAINERSPLUS_H
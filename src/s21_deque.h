@@ -0,0 +1,421 @@
+#ifndef CPP2_SRC_S21_DEQUE_H_
+#define CPP2_SRC_S21_DEQUE_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+#include "stdexcept"
+
+namespace s21 {
+
+/*
+Double-ended queue. Elements live in fixed-size blocks (about 4 KiB each); an
+array of pointers to the blocks (the "map") keeps them in order. Element i is
+found at block (start + i) / kBlockSize, slot (start + i) % kBlockSize, so
+random access is O(1) and push/pop at either end is amortised O(1).
+
+Blocks never move: growing at either end only reallocates the small map, so
+references to elements stay valid on push_front/push_back and on pops of other
+elements. As with s21::Vector, T has to be default constructible.
+ */
+template <typename T>
+class Deque {
+ public:
+  // attributes
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+ private:
+  // random access iterator: remembers the deque and the logical index, so it
+  // survives map reallocations (but not insert/erase before it)
+  template <typename DequePtr, typename Ref, typename Ptr>
+  class DequeIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Ptr;
+    using reference = Ref;
+
+    DequeIterator() : deque(nullptr), index(0) {}
+    DequeIterator(DequePtr deque, size_type index)
+        : deque(deque), index(index) {}
+
+    // const_iterator can be built from iterator
+    template <typename OtherPtr, typename OtherRef, typename OtherP>
+    DequeIterator(const DequeIterator<OtherPtr, OtherRef, OtherP> &other)
+        : deque(other.deque), index(other.index) {}
+
+    reference operator*() const { return (*deque)[index]; }
+    pointer operator->() const { return &(*deque)[index]; }
+    reference operator[](difference_type n) const {
+      return (*deque)[index + n];
+    }
+
+    DequeIterator &operator++() {
+      ++index;
+      return *this;
+    }
+    DequeIterator operator++(int) {
+      DequeIterator tmp = *this;
+      ++index;
+      return tmp;
+    }
+    DequeIterator &operator--() {
+      --index;
+      return *this;
+    }
+    DequeIterator operator--(int) {
+      DequeIterator tmp = *this;
+      --index;
+      return tmp;
+    }
+
+    DequeIterator &operator+=(difference_type n) {
+      index += n;
+      return *this;
+    }
+    DequeIterator &operator-=(difference_type n) {
+      index -= n;
+      return *this;
+    }
+    DequeIterator operator+(difference_type n) const {
+      return DequeIterator(deque, index + n);
+    }
+    DequeIterator operator-(difference_type n) const {
+      return DequeIterator(deque, index - n);
+    }
+    friend DequeIterator operator+(difference_type n, const DequeIterator &it) {
+      return it + n;
+    }
+    difference_type operator-(const DequeIterator &other) const {
+      return static_cast<difference_type>(index) -
+             static_cast<difference_type>(other.index);
+    }
+
+    bool operator==(const DequeIterator &other) const {
+      return index == other.index && deque == other.deque;
+    }
+    bool operator!=(const DequeIterator &other) const {
+      return !(*this == other);
+    }
+    bool operator<(const DequeIterator &other) const {
+      return index < other.index;
+    }
+    bool operator>(const DequeIterator &other) const {
+      return index > other.index;
+    }
+    bool operator<=(const DequeIterator &other) const {
+      return index <= other.index;
+    }
+    bool operator>=(const DequeIterator &other) const {
+      return index >= other.index;
+    }
+
+   private:
+    template <typename, typename, typename>
+    friend class DequeIterator;
+
+    DequePtr deque;
+    size_type index;
+  };
+
+ public:
+  using iterator = DequeIterator<Deque *, reference, value_type *>;
+  using const_iterator =
+      DequeIterator<const Deque *, const_reference, const value_type *>;
+
+  Deque() : dMap(nullptr), dMapSize(0), dStart(0), dSize(0) {}
+
+  explicit Deque(size_type n) : Deque() {
+    for (size_type i = 0; i < n; ++i) {
+      push_back(value_type());
+    }
+  }
+
+  Deque(std::initializer_list<value_type> const &items) : Deque() {
+    for (const_reference item : items) {
+      push_back(item);
+    }
+  }
+
+  Deque(const Deque &d) : Deque() {
+    for (size_type i = 0; i < d.dSize; ++i) {
+      push_back(d[i]);
+    }
+  }
+
+  Deque(Deque &&d) noexcept : Deque() { swap(d); }
+
+  ~Deque() {
+    FreeBlocks();
+    delete[] dMap;
+  }
+
+  /*
+  Replaces the contents of the container.
+   */
+  Deque &operator=(const Deque &d) {
+    if (this != &d) {
+      Deque copy(d);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  Deque &operator=(Deque &&d) noexcept {
+    Deque moved(std::move(d));
+    swap(moved);
+    return *this;
+  }
+
+  /*
+  Returns a reference to the element at specified location pos, with bounds
+  checking. If pos is not within the range of the container, an exception of
+  type std::out_of_range is thrown.
+  */
+  reference at(size_type pos) {
+    if (pos >= dSize) throw std::out_of_range("Element is out of deque!");
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= dSize) throw std::out_of_range("Element is out of deque!");
+    return (*this)[pos];
+  }
+
+  /*
+  Returns a reference to the element at specified location pos. No bounds
+  checking is performed.
+  */
+  reference operator[](size_type pos) { return Slot(dStart + pos); }
+
+  const_reference operator[](size_type pos) const {
+    return Slot(dStart + pos);
+  }
+
+  /*
+  Returns a reference to the first element in the container.
+  Calling front on an empty container causes undefined behavior.
+   */
+  reference front() { return Slot(dStart); }
+
+  const_reference front() const { return Slot(dStart); }
+
+  /*
+  Returns a reference to the last element in the container.
+  Calling back on an empty container causes undefined behavior.
+   */
+  reference back() { return Slot(dStart + dSize - 1); }
+
+  const_reference back() const { return Slot(dStart + dSize - 1); }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+  iterator end() noexcept { return iterator(this, dSize); }
+
+  const_iterator end() const noexcept { return const_iterator(this, dSize); }
+
+  /*
+  Checks if the container has no elements.
+  */
+  bool empty() const noexcept { return dSize == 0; }
+
+  /*
+  Returns the number of elements in the container.
+  */
+  size_type size() const noexcept { return dSize; }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+
+  /*
+  Erases all elements and frees every block; the map itself is kept.
+   */
+  void clear() noexcept {
+    FreeBlocks();
+    dStart = dMapSize / 2 * kBlockSize;
+    dSize = 0;
+  }
+
+  void push_back(const_reference value) {
+    if (dStart + dSize == dMapSize * kBlockSize) {
+      GrowMap();
+    }
+    AllocateBlock(dStart + dSize) = value;
+    ++dSize;
+  }
+
+  void push_front(const_reference value) {
+    if (dStart == 0) {
+      GrowMap();
+    }
+    AllocateBlock(dStart - 1) = value;
+    --dStart;
+    ++dSize;
+  }
+
+  /*
+  Removes the last element. A block is freed as soon as its last element is
+  gone. Calling pop_back on an empty container results in undefined behavior.
+   */
+  void pop_back() {
+    --dSize;
+    ReleaseSlot(dStart + dSize);
+  }
+
+  /*
+  Removes the first element.
+  Calling pop_front on an empty container results in undefined behavior.
+   */
+  void pop_front() {
+    ++dStart;
+    --dSize;
+    ReleaseSlot(dStart - 1);
+  }
+
+  /*
+  Inserts value before pos. Elements on the shorter side of pos are shifted by
+  one, so the cost is O(min(distance to begin, distance to end)).
+   */
+  iterator insert(const_iterator pos, const_reference value) {
+    size_type index = static_cast<size_type>(pos - cbegin());
+    value_type tmp = value;  // value may refer to an element of this deque
+    if (index < dSize / 2) {
+      push_front(tmp);
+      for (size_type i = 0; i < index; ++i) {
+        (*this)[i] = std::move((*this)[i + 1]);
+      }
+    } else {
+      push_back(tmp);
+      for (size_type i = dSize - 1; i > index; --i) {
+        (*this)[i] = std::move((*this)[i - 1]);
+      }
+    }
+    (*this)[index] = std::move(tmp);
+    return begin() + index;
+  }
+
+  /*
+  Erases the element at pos, shifting the shorter side of the deque.
+  Returns the iterator following the removed element.
+   */
+  iterator erase(const_iterator pos) {
+    size_type index = static_cast<size_type>(pos - cbegin());
+    if (index < dSize / 2) {
+      for (size_type i = index; i > 0; --i) {
+        (*this)[i] = std::move((*this)[i - 1]);
+      }
+      pop_front();
+    } else {
+      for (size_type i = index; i + 1 < dSize; ++i) {
+        (*this)[i] = std::move((*this)[i + 1]);
+      }
+      pop_back();
+    }
+    return begin() + index;
+  }
+
+  /*
+  Exchanges the contents of the container with those of other. Does not invoke
+  any move, copy, or swap operations on individual elements.
+   */
+  void swap(Deque &other) noexcept {
+    std::swap(dMap, other.dMap);
+    std::swap(dMapSize, other.dMapSize);
+    std::swap(dStart, other.dStart);
+    std::swap(dSize, other.dSize);
+  }
+
+ private:
+  // elements per block: a power of two, about 4 KB per block
+  static constexpr size_type BlockSize() {
+    size_type size = 16;
+    while (size * 2 * sizeof(value_type) <= 4096) {
+      size *= 2;
+    }
+    return size;
+  }
+  static constexpr size_type kBlockSize = BlockSize();
+
+  value_type **dMap;   // array of pointers to blocks
+  size_type dMapSize;  // number of pointers in dMap
+  size_type dStart;    // absolute index of the first element
+  size_type dSize;     // number of elements
+
+  // support
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  reference Slot(size_type abs) {
+    return dMap[abs / kBlockSize][abs % kBlockSize];
+  }
+
+  const_reference Slot(size_type abs) const {
+    return dMap[abs / kBlockSize][abs % kBlockSize];
+  }
+
+  reference AllocateBlock(size_type abs) {
+    value_type *&block = dMap[abs / kBlockSize];
+    if (block == nullptr) {
+      block = new value_type[kBlockSize]();
+    }
+    return block[abs % kBlockSize];
+  }
+
+  // the slot goes back to the default value (like Vector::pop_back); its block
+  // is freed once no element of it is left. The block of an emptied deque is
+  // kept, so a push/pop cycle on an empty container does not allocate
+  void ReleaseSlot(size_type abs) {
+    Slot(abs) = value_type();
+    size_type block = abs / kBlockSize;
+    if (dSize != 0 && (block < dStart / kBlockSize ||
+                       block > (dStart + dSize - 1) / kBlockSize)) {
+      delete[] dMap[block];
+      dMap[block] = nullptr;
+    }
+  }
+
+  // a new map twice as large as the occupied part, with the occupied blocks
+  // in the middle so both ends have room to grow
+  void GrowMap() {
+    size_type first_block = dStart / kBlockSize;
+    size_type last_block =
+        dSize != 0 ? (dStart + dSize - 1) / kBlockSize : first_block;
+    size_type used = last_block - first_block + 1;
+    size_type new_map_size = used * 2 + 2 > 8 ? used * 2 + 2 : 8;
+    size_type offset = (new_map_size - used) / 2;
+
+    value_type **new_map = new value_type *[new_map_size]();
+    for (size_type b = 0; b < dMapSize; ++b) {
+      if (b >= first_block && b <= last_block) {
+        new_map[offset + b - first_block] = dMap[b];
+      } else {
+        delete[] dMap[b];
+      }
+    }
+    delete[] dMap;
+
+    dMap = new_map;
+    dMapSize = new_map_size;
+    dStart = offset * kBlockSize + dStart % kBlockSize;
+  }
+
+  void FreeBlocks() noexcept {
+    for (size_type b = 0; b < dMapSize; ++b) {
+      delete[] dMap[b];
+      dMap[b] = nullptr;
+    }
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_DEQUE_H_
@@ -0,0 +1,325 @@
+#ifndef CPP2_SRC_S21_FLAT_MAP_H_
+#define CPP2_SRC_S21_FLAT_MAP_H_
+
+#include <algorithm>  // для std::lower_bound, std::stable_sort
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>  // для std::pair
+
+#include "pair_ref.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// ========== ИТЕРАТОР ========== //
+// Ключи и значения лежат в двух параллельных массивах, итератор держит
+// указатели на один и тот же номер в обоих. Как у s21::map, (*iter).first -
+// ключ, iter->second - значение; пара собирается из ссылок (pair_ref.h)
+template <typename Key, typename T>
+class FlatMapIterator {
+ public:
+  const Key *key_;
+  T *val_;
+
+  FlatMapIterator(const Key *key, T *val) : key_(key), val_(val) {}
+
+  PairRef<Key, T> operator*() const { return PairRef<Key, T>(*key_, *val_); }
+  PairArrow<Key, T> operator->() const {
+    return PairArrow<Key, T>(*key_, *val_);
+  }
+
+  FlatMapIterator &operator++() {
+    ++key_;
+    ++val_;
+    return *this;
+  }
+
+  FlatMapIterator operator++(int) {
+    FlatMapIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  FlatMapIterator &operator--() {
+    --key_;
+    --val_;
+    return *this;
+  }
+
+  FlatMapIterator operator--(int) {
+    FlatMapIterator tmp = *this;
+    --(*this);
+    return tmp;
+  }
+
+  bool operator==(const FlatMapIterator &other) const {
+    return key_ == other.key_;
+  }
+
+  bool operator!=(const FlatMapIterator &other) const {
+    return key_ != other.key_;
+  }
+};
+
+/*
+Sorted-array dictionary with the s21::map method names, so switching between
+the two is a typedef change. Keys and values are kept in two s21::Vector's
+sorted by key: lookups are a binary search over a dense key array, and there
+is no per-element allocation. A single insert or erase shifts the tail, O(n),
+so build from a batch (constructor or range insert) whenever possible: the
+batch is sorted and deduplicated once, then merged in one linear pass.
+Any insert or erase invalidates iterators. *iter is a pair of references
+returned by value, so range-for takes `auto item`, not `auto &item`.
+ */
+template <typename Key, typename T>
+class flat_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = FlatMapIterator<key_type, mapped_type>;
+  using const_iterator = FlatMapIterator<key_type, mapped_type>;
+  using size_type = std::size_t;
+
+  flat_map() : keys_(), values_() {}
+
+  flat_map(std::initializer_list<value_type> const &items)
+      : flat_map(items.begin(), items.end()) {}
+
+  // bulk construction from unsorted input; of equal keys the first one wins,
+  // like repeated map::insert
+  template <typename InputIt>
+  flat_map(InputIt first, InputIt last) : flat_map() {
+    insert(first, last);
+  }
+
+  flat_map(const flat_map &other)
+      : keys_(other.keys_), values_(other.values_) {}
+  flat_map(flat_map &&other)
+      : keys_(std::move(other.keys_)), values_(std::move(other.values_)) {}
+
+  ~flat_map() {}
+
+  flat_map &operator=(flat_map &&other) {
+    keys_ = std::move(other.keys_);
+    values_ = std::move(other.values_);
+    return *this;
+  }
+
+  // element access
+
+  mapped_type &at(const key_type &key) {
+    size_type pos = LowerIndex(key);
+    if (!Found(pos, key)) {
+      throw std::out_of_range("s21::flat_map::at: out_of_range");
+    }
+    return values_[pos];
+  }
+
+  mapped_type &operator[](const key_type &key) {
+    return insert(key, mapped_type()).first->second;
+  }
+
+  // iterators
+
+  iterator begin() { return Make(0); }
+
+  iterator end() { return Make(keys_.size()); }
+
+  // capacity
+
+  bool empty() { return keys_.empty(); }
+
+  size_type size() { return keys_.size(); }
+
+  size_type max_size() { return keys_.max_size(); }
+
+  void reserve(size_type n) {
+    keys_.reserve(n);
+    values_.reserve(n);
+  }
+
+  // modifiers
+
+  void clear() {
+    keys_.clear();
+    values_.clear();
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    size_type pos = LowerIndex(key);
+    if (Found(pos, key)) {
+      return std::make_pair(Make(pos), false);
+    }
+    keys_.insert(keys_.begin() + pos, key);
+    try {
+      values_.insert(values_.begin() + pos, obj);
+    } catch (...) {
+      // the arrays must stay the same length: drop the new key, and the
+      // value slot too if Vector::insert had already opened it
+      if (values_.size() == keys_.size()) {
+        values_.erase(values_.begin() + pos);
+      }
+      keys_.erase(keys_.begin() + pos);
+      throw;
+    }
+    return std::make_pair(Make(pos), true);
+  }
+
+  // batched insert: the input is sorted and deduplicated once, then merged
+  // with the current contents in one pass, O(n + m log m) instead of m
+  // shifts of the whole array
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last) {
+    Vector<std::pair<key_type, mapped_type>> run;
+    for (; first != last; ++first) {
+      run.push_back(std::pair<key_type, mapped_type>(first->first,
+                                                     first->second));
+    }
+    std::stable_sort(run.begin(), run.end(),
+                     [](const std::pair<key_type, mapped_type> &a,
+                        const std::pair<key_type, mapped_type> &b) {
+                       return a.first < b.first;
+                     });
+    Vector<key_type> run_keys;
+    Vector<mapped_type> run_values;
+    run_keys.reserve(run.size());
+    run_values.reserve(run.size());
+    for (auto &item : run) {
+      if (run_keys.empty() || run_keys.back() < item.first) {
+        run_keys.push_back(item.first);
+        run_values.push_back(item.second);
+      }
+    }
+    MergeRun(run_keys, run_values);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    std::pair<iterator, bool> r = insert(key, obj);
+    if (!r.second) r.first->second = obj;
+    return r;
+  }
+
+  void erase(iterator pos) {
+    size_type index = pos.key_ - keys_.data();
+    keys_.erase(keys_.begin() + index);
+    values_.erase(values_.begin() + index);
+  }
+
+  void swap(flat_map &other) {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+  }
+
+  // like s21::map::merge: elements of other whose keys are not here move
+  // here, the rest stay in other. Both arrays are sorted, so this is one
+  // linear pass
+  void merge(flat_map &other) {
+    if (this == &other || other.empty()) return;
+    Vector<key_type> keys;
+    Vector<mapped_type> values;
+    Vector<key_type> rest_keys;
+    Vector<mapped_type> rest_values;
+    keys.reserve(keys_.size() + other.keys_.size());
+    values.reserve(keys_.size() + other.keys_.size());
+    size_type i = 0;
+    size_type j = 0;
+    while (i < keys_.size() || j < other.keys_.size()) {
+      if (j == other.keys_.size() ||
+          (i < keys_.size() && keys_[i] < other.keys_[j])) {
+        keys.push_back(keys_[i]);
+        values.push_back(values_[i++]);
+      } else if (i == keys_.size() || other.keys_[j] < keys_[i]) {
+        keys.push_back(other.keys_[j]);
+        values.push_back(other.values_[j++]);
+      } else {
+        rest_keys.push_back(other.keys_[j]);
+        rest_values.push_back(other.values_[j++]);
+      }
+    }
+    keys_.swap(keys);
+    values_.swap(values);
+    other.keys_.swap(rest_keys);
+    other.values_.swap(rest_values);
+  }
+
+  // lookup
+
+  iterator find(const key_type &key) {
+    size_type pos = LowerIndex(key);
+    return Found(pos, key) ? Make(pos) : end();
+  }
+
+  bool contains(const key_type &key) { return Found(LowerIndex(key), key); }
+
+  iterator lower_bound(const key_type &key) { return Make(LowerIndex(key)); }
+
+  iterator upper_bound(const key_type &key) {
+    return Make(std::upper_bound(keys_.begin(), keys_.end(), key) -
+                keys_.begin());
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+ private:
+  Vector<key_type> keys_;
+  Vector<mapped_type> values_;
+
+  iterator Make(size_type pos) {
+    return iterator(keys_.data() + pos, values_.data() + pos);
+  }
+
+  size_type LowerIndex(const key_type &key) {
+    return std::lower_bound(keys_.begin(), keys_.end(), key) - keys_.begin();
+  }
+
+  bool Found(size_type pos, const key_type &key) {
+    return pos < keys_.size() && !(key < keys_[pos]);
+  }
+
+  // сливает с отсортированным набором без повторов в новые массивы,
+  // при равных ключах остается уже имеющееся значение
+  void MergeRun(const Vector<key_type> &run_keys,
+                const Vector<mapped_type> &run_values) {
+    if (run_keys.empty()) return;
+    Vector<key_type> keys;
+    Vector<mapped_type> values;
+    keys.reserve(keys_.size() + run_keys.size());
+    values.reserve(keys_.size() + run_keys.size());
+    size_type i = 0;
+    size_type j = 0;
+    while (i < keys_.size() && j < run_keys.size()) {
+      if (run_keys[j] < keys_[i]) {
+        keys.push_back(run_keys[j]);
+        values.push_back(run_values[j++]);
+      } else {
+        if (!(keys_[i] < run_keys[j])) ++j;
+        keys.push_back(keys_[i]);
+        values.push_back(values_[i++]);
+      }
+    }
+    for (; i < keys_.size(); ++i) {
+      keys.push_back(keys_[i]);
+      values.push_back(values_[i]);
+    }
+    for (; j < run_keys.size(); ++j) {
+      keys.push_back(run_keys[j]);
+      values.push_back(run_values[j]);
+    }
+    keys_.swap(keys);
+    values_.swap(values);
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_FLAT_MAP_H_
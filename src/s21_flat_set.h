@@ -0,0 +1,170 @@
+#ifndef CPP2_SRC_S21_FLAT_SET_H_
+#define CPP2_SRC_S21_FLAT_SET_H_
+
+#include <algorithm>  // для std::lower_bound, std::sort
+#include <initializer_list>
+#include <utility>  // для std::pair
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+/*
+Sorted-array set with the s21::set method names, stored in one s21::Vector.
+Lookups are a binary search, iteration is a walk over contiguous memory.
+A single insert or erase shifts the tail, O(n); batches (constructor, range
+insert, merge) are sorted and deduplicated once and merged in one linear
+pass. Any insert or erase invalidates iterators.
+ */
+template <typename Key>
+class flat_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = const value_type *;
+  using const_iterator = const value_type *;
+  using size_type = std::size_t;
+
+  flat_set() : keys_() {}
+
+  flat_set(std::initializer_list<value_type> const &items)
+      : flat_set(items.begin(), items.end()) {}
+
+  // bulk construction from unsorted input
+  template <typename InputIt>
+  flat_set(InputIt first, InputIt last) : flat_set() {
+    insert(first, last);
+  }
+
+  flat_set(const flat_set &other) : keys_(other.keys_) {}
+  flat_set(flat_set &&other) : keys_(std::move(other.keys_)) {}
+
+  ~flat_set() {}
+
+  flat_set &operator=(flat_set &&other) {
+    keys_ = std::move(other.keys_);
+    return *this;
+  }
+
+  // iterators
+
+  iterator begin() const noexcept { return keys_.data(); }
+
+  iterator end() const noexcept { return keys_.data() + keys_.size(); }
+
+  // capacity
+
+  bool empty() const noexcept { return keys_.empty(); }
+
+  size_type size() const noexcept { return keys_.size(); }
+
+  size_type max_size() const noexcept { return keys_.max_size(); }
+
+  void reserve(size_type n) { keys_.reserve(n); }
+
+  // modifiers
+
+  void clear() { keys_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    iterator pos = lower_bound(value);
+    if (pos != end() && !(value < *pos)) {
+      return std::make_pair(pos, false);
+    }
+    return std::make_pair(
+        keys_.insert(keys_.begin() + (pos - begin()), value), true);
+  }
+
+  // batched insert: sort plus dedup of the input, then one linear merge
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last) {
+    Vector<key_type> run;
+    for (; first != last; ++first) run.push_back(*first);
+    std::sort(run.begin(), run.end());
+    size_type unique = 0;
+    for (size_type i = 0; i < run.size(); ++i) {
+      if (unique == 0 || run[unique - 1] < run[i]) {
+        if (unique != i) run[unique] = std::move(run[i]);
+        ++unique;
+      }
+    }
+    while (run.size() > unique) run.pop_back();
+    MergeRun(run);
+  }
+
+  void erase(iterator pos) { keys_.erase(pos); }
+
+  void swap(flat_set &other) { keys_.swap(other.keys_); }
+
+  // like s21::set::merge: keys of other that are not here move here, the
+  // rest stay in other; one linear pass over both sorted arrays
+  void merge(flat_set &other) {
+    if (this == &other || other.empty()) return;
+    Vector<key_type> keys;
+    Vector<key_type> rest;
+    keys.reserve(keys_.size() + other.keys_.size());
+    size_type i = 0;
+    size_type j = 0;
+    while (i < keys_.size() || j < other.keys_.size()) {
+      if (j == other.keys_.size() ||
+          (i < keys_.size() && keys_[i] < other.keys_[j])) {
+        keys.push_back(keys_[i++]);
+      } else if (i == keys_.size() || other.keys_[j] < keys_[i]) {
+        keys.push_back(other.keys_[j++]);
+      } else {
+        rest.push_back(other.keys_[j++]);
+      }
+    }
+    keys_.swap(keys);
+    other.keys_.swap(rest);
+  }
+
+  // lookup
+
+  iterator find(const key_type &key) const {
+    iterator pos = lower_bound(key);
+    return pos != end() && !(key < *pos) ? pos : end();
+  }
+
+  bool contains(const key_type &key) const { return find(key) != end(); }
+
+  iterator lower_bound(const key_type &key) const {
+    return std::lower_bound(begin(), end(), key);
+  }
+
+  iterator upper_bound(const key_type &key) const {
+    return std::upper_bound(begin(), end(), key);
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) const {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+ private:
+  Vector<key_type> keys_;
+
+  // сливает с отсортированным массивом без повторов в новый массив
+  void MergeRun(const Vector<key_type> &run) {
+    if (run.empty()) return;
+    Vector<key_type> keys;
+    keys.reserve(keys_.size() + run.size());
+    size_type i = 0;
+    size_type j = 0;
+    while (i < keys_.size() && j < run.size()) {
+      if (run[j] < keys_[i]) {
+        keys.push_back(run[j++]);
+      } else {
+        if (!(keys_[i] < run[j])) ++j;
+        keys.push_back(keys_[i++]);
+      }
+    }
+    for (; i < keys_.size(); ++i) keys.push_back(keys_[i]);
+    for (; j < run.size(); ++j) keys.push_back(run[j]);
+    keys_.swap(keys);
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_FLAT_SET_H_
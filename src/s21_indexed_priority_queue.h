@@ -0,0 +1,255 @@
+#ifndef CPP2_SRC_S21_INDEXED_PRIORITY_QUEUE_H_
+#define CPP2_SRC_S21_INDEXED_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <functional>  // for std::less
+#include <limits>
+#include <utility>
+
+#include "s21_vector.h"
+#include "stdexcept"
+
+namespace s21 {
+
+/*
+d-ary heap with a handle table. Every pushed element gets a handle that stays
+valid (and keeps referring to the same element) until the element is popped or
+erased, no matter how the heap is reorganised. Through the handle the priority
+of an element can be changed or the element can be removed in O(log n), which
+is what Dijkstra-style "decrease key" and timer cancellation need.
+
+The heap stores (value, handle) pairs; the handle table maps a handle to the
+current heap position of its element. Handles of removed elements are reused
+by later pushes.
+
+As in PriorityQueue, top() is the "largest" element according to Compare, so
+std::greater<T> gives a min-queue.
+ */
+template <typename T, typename Compare = std::less<T>, std::size_t Arity = 4>
+class IndexedPriorityQueue {
+  static_assert(Arity >= 2, "IndexedPriorityQueue: Arity must be at least 2");
+
+ public:
+  // attributes
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using handle_type = std::size_t;
+  using value_compare = Compare;
+
+  // handle that never refers to an element
+  static constexpr handle_type npos = std::numeric_limits<handle_type>::max();
+
+  IndexedPriorityQueue() : heap(), position(), free_handles(), comp() {}
+
+  explicit IndexedPriorityQueue(const Compare &compare)
+      : heap(), position(), free_handles(), comp(compare) {}
+
+  IndexedPriorityQueue(const IndexedPriorityQueue &q) = default;
+  IndexedPriorityQueue(IndexedPriorityQueue &&q) noexcept = default;
+  IndexedPriorityQueue &operator=(const IndexedPriorityQueue &q) = default;
+  IndexedPriorityQueue &operator=(IndexedPriorityQueue &&q) noexcept = default;
+  ~IndexedPriorityQueue() = default;
+
+  /*
+  Returns a reference to the element with the highest priority.
+  Calling top on an empty queue causes undefined behavior.
+   */
+  const_reference top() const { return heap[0].value; }
+
+  /*
+  Returns the handle of the top element.
+   */
+  handle_type top_handle() const { return heap[0].handle; }
+
+  /*
+  Checks if the container has no elements.
+  */
+  bool empty() const noexcept { return heap.empty(); }
+
+  /*
+  Returns the number of elements in the container.
+  */
+  size_type size() const noexcept { return heap.size(); }
+
+  /*
+  Checks whether handle refers to an element that is still in the queue.
+   */
+  bool contains(handle_type handle) const noexcept {
+    return handle < position.size() && position[handle] != npos;
+  }
+
+  /*
+  Returns the element referred to by handle, with bounds checking. An exception
+  of type std::out_of_range is thrown for a stale handle.
+   */
+  const_reference at(handle_type handle) const {
+    if (!contains(handle)) {
+      throw std::out_of_range("s21::IndexedPriorityQueue::at: bad handle");
+    }
+    return heap[position[handle]].value;
+  }
+
+  /*
+  Inserts value in O(log n) and returns its handle.
+   */
+  handle_type push(const_reference value) {
+    handle_type handle = AcquireHandle();
+    heap.push_back(Entry{value, handle});
+    position[handle] = heap.size() - 1;
+    SiftUp(heap.size() - 1);
+    return handle;
+  }
+
+  /*
+  Constructs the element from args and inserts it like push().
+   */
+  template <typename... Args>
+  handle_type emplace(Args &&...args) {
+    return push(value_type(std::forward<Args>(args)...));
+  }
+
+  /*
+  Removes the top element. Its handle becomes stale.
+  Calling pop on an empty queue causes undefined behavior.
+   */
+  void pop() { RemoveAt(0); }
+
+  /*
+  Replaces the priority of the element referred to by handle and restores the
+  heap order in O(log n): the element moves up if its priority grew, down if
+  it fell. Throws std::out_of_range for a stale handle.
+   */
+  void update(handle_type handle, const_reference value) {
+    if (!contains(handle)) {
+      throw std::out_of_range("s21::IndexedPriorityQueue::update: bad handle");
+    }
+    size_type pos = position[handle];
+    bool up = comp(heap[pos].value, value);
+    heap[pos].value = value;
+    if (up) {
+      SiftUp(pos);
+    } else {
+      SiftDown(pos);
+    }
+  }
+
+  /*
+  Removes the element referred to by handle in O(log n).
+  Throws std::out_of_range for a stale handle.
+   */
+  void erase(handle_type handle) {
+    if (!contains(handle)) {
+      throw std::out_of_range("s21::IndexedPriorityQueue::erase: bad handle");
+    }
+    RemoveAt(position[handle]);
+  }
+
+  /*
+  Removes all elements. All handles become stale.
+   */
+  void clear() {
+    IndexedPriorityQueue empty_queue(comp);
+    swap(empty_queue);
+  }
+
+  /*
+  Exchanges the contents of the container with those of others.
+   */
+  void swap(IndexedPriorityQueue &other) {
+    heap.swap(other.heap);
+    position.swap(other.position);
+    free_handles.swap(other.free_handles);
+    std::swap(comp, other.comp);
+  }
+
+ private:
+  struct Entry {
+    value_type value;
+    handle_type handle;
+  };
+
+  Vector<Entry> heap;                // the heap itself
+  Vector<size_type> position;        // handle -> heap index (or npos)
+  Vector<handle_type> free_handles;  // released handles, reused first
+  Compare comp;
+
+  // support
+  static size_type Parent(size_type pos) { return (pos - 1) / Arity; }
+  static size_type FirstChild(size_type pos) { return pos * Arity + 1; }
+
+  handle_type AcquireHandle() {
+    if (!free_handles.empty()) {
+      handle_type handle = free_handles.back();
+      free_handles.pop_back();
+      return handle;
+    }
+    position.push_back(npos);
+    return position.size() - 1;
+  }
+
+  // the last element fills the gap and is moved up or down from there
+  void RemoveAt(size_type pos) {
+    handle_type handle = heap[pos].handle;
+    position[handle] = npos;
+    free_handles.push_back(handle);
+
+    size_type last = heap.size() - 1;
+    if (pos != last) {
+      bool up = comp(heap[pos].value, heap[last].value);
+      Place(pos, std::move(heap[last]));
+      heap.pop_back();
+      if (up) {
+        SiftUp(pos);
+      } else {
+        SiftDown(pos);
+      }
+    } else {
+      heap.pop_back();
+    }
+  }
+
+  // writes the entry into the heap slot and keeps the handle table in sync
+  void Place(size_type pos, Entry &&entry) {
+    position[entry.handle] = pos;
+    heap[pos] = std::move(entry);
+  }
+
+  void SiftUp(size_type pos) {
+    Entry entry = std::move(heap[pos]);
+    while (pos > 0) {
+      size_type parent = Parent(pos);
+      if (!comp(heap[parent].value, entry.value)) {
+        break;
+      }
+      Place(pos, std::move(heap[parent]));
+      pos = parent;
+    }
+    Place(pos, std::move(entry));
+  }
+
+  void SiftDown(size_type pos) {
+    Entry entry = std::move(heap[pos]);
+    size_type n = heap.size();
+    for (size_type child = FirstChild(pos); child < n;
+         child = FirstChild(pos)) {
+      size_type best = child;
+      size_type last = child + Arity < n ? child + Arity : n;
+      for (size_type i = child + 1; i < last; ++i) {
+        if (comp(heap[best].value, heap[i].value)) {
+          best = i;
+        }
+      }
+      if (!comp(entry.value, heap[best].value)) {
+        break;
+      }
+      Place(pos, std::move(heap[best]));
+      pos = best;
+    }
+    Place(pos, std::move(entry));
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_INDEXED_PRIORITY_QUEUE_H_
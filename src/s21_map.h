@@ -1,277 +1,521 @@
-#ifndef CPP2_SRC_S21_MAP_H_
-#define CPP2_SRC_S21_MAP_H_
-
-#include <utility>  // для std::pair
-
-#include "tree.h"
-
-namespace s21 {
-template <typename T, typename V>
-class map {
- public:
-  // внутриклассовые переопределения типов (типичные для стандартной библиотеки
-  // STL), принятые для удобства восприятия кода класса:
-  using key_type = T;
-  using mapped_type = V;
-  using default_value = mapped_type&;
-  using value_type = std::pair<const key_type, mapped_type>;
-  using iterator = Iterator<T, V>;
-  using size_type = size_t;
-
-  // КОНСТРУКТОРЫ И ДЕСТРУКТОРЫ
-  // создает пустой словарь
-  map();
-
-  // Конструктор - создает словарь с переданными списками
-  map(std::initializer_list<value_type> const& items);
-
-  // Конструктор копирования
-  map(const map& m);
-  // Конструктор перемещения
-  map(map&& m);
-
-  ~map();
-
-  // ПАРАМЕТРЫ
- private:
-  Tree<key_type, mapped_type> tree_in_map;
-
- public:
-  // геттер к доступу параметра дерева
-  Tree<key_type, mapped_type> GetTree() { return this->tree_in_map; }
-  map<T, V> operator=(map&& m);
-  mapped_type& at(const T& key);
-  mapped_type& operator[](const T& key);
-
-  // возвращает указатель на начало и конец
-  iterator begin();
-  iterator end();
-
-  void clear();  // очищает словарь
-  bool empty();  // возвращает true, если контейнер пустой
-  size_type size();  // возвращает размер контейнера
-  size_type max_size();  // возвращает максимальный размер контейнера
-
-  // методы для изменения контейнера
-
-  // ВСТАВКА УЗЛОВ
-  std::pair<iterator, bool> insert(const value_type& value);
-  std::pair<iterator, bool> insert(const T& key, const V& obj);
-  std::pair<iterator, bool> insert_or_assign(const T& key, const V& obj);
-
-  // удаление узла
-  void erase(iterator pos);
-
-  // смена содержимого контейнера на другое
-  void swap(map& other);
-
-  // слияние передаваемого словаря в первый
-  void merge(map& other);
-
-  bool contains(const T& key);
-
-  // вспомогательные методы
-  // проверка что такого ключа нет в словаре
-  bool check_unique(const value_type& value);
-};
-
-// инициализируем пустой словарь где в качестве параметра пустое дерево
-template <typename T, typename V>
-map<T, V>::map() : tree_in_map() {}
-
-template <typename T, typename V>
-map<T, V>::map(std::initializer_list<value_type> const& items) : map() {
-  for (value_type item : items) {
-    insert(item);
-  }
-}
-
-template <typename T, typename V>
-map<T, V>::map(const map& m) : tree_in_map(m.tree_in_map) {}
-
-template <typename T, typename V>
-map<T, V>::map(map&& m) : tree_in_map(std::move(m.tree_in_map)) {
-  m.clear();
-}
-
-template <typename T, typename V>
-map<T, V>::~map() {}
-
-template <typename T, typename V>
-map<T, V> map<T, V>::operator=(map<T, V>&& m) {
-  if (this != &m) {
-    tree_in_map = std::move(m.tree_in_map);
-  }
-  return *this;
-}
-
-template <typename T, typename V>
-typename map<T, V>::mapped_type& map<T, V>::at(const T& key) {
-  Node<T, V>* vt = this->tree_in_map.Search(key);
-  if (vt == nullptr) {
-    throw std::out_of_range("s21::map::at: out_of_range");
-  } else {
-    return vt->val;
-  }
-}
-
-template <typename T, typename V>
-typename map<T, V>::mapped_type& map<T, V>::operator[](const T& key) {
-  iterator i = this->begin();
-  if (i.node_ != nullptr) {
-    for (; i != this->end(); i++) {
-      if (i.node_->key == key) {
-        return i.node_->val;
-      }
-    }
-
-    std::pair<iterator, bool> res = insert(value_type(key, mapped_type()));
-
-    iterator i = res.first;
-    return i.node_->val;
-  }
-  static mapped_type default_value;
-  return default_value;
-}
-
-template <typename T, typename V>
-bool map<T, V>::empty() {
-  if (this->tree_in_map.GetSize() == 0) {
-    return true;
-  } else {
-    return false;
-  }
-}
-
-template <typename T, typename V>
-typename map<T, V>::size_type map<T, V>::size() {
-  return this->tree_in_map.GetSize();
-}
-
-template <typename T, typename V>
-typename map<T, V>::size_type map<T, V>::max_size() {
-  return this->tree_in_map.MaxSize();
-}
-
-// методы для итеррирования по элементам контейнера
-template <typename T, typename V>
-typename map<T, V>::iterator map<T, V>::begin() {
-  Node<T, V>* node = this->tree_in_map.GetRoot();
-  while (node->left != nullptr) {
-    node = node->left;
-  }
-  return iterator(node, tree_in_map.GetRoot());
-}
-
-template <typename T, typename V>
-typename map<T, V>::iterator map<T, V>::end() {
-  Node<T, V>* node = tree_in_map.GetRoot();
-  while (node->right != nullptr) {
-    node = node->right;
-  }
-  return iterator(node, tree_in_map.GetRoot());
-}
-
-// методы для изменения контейнера
-
-template <typename T, typename V>
-void map<T, V>::clear() {
-  this->tree_in_map.ClearTree(tree_in_map.GetRoot());
-}
-
-// вставляет узел и возвращает итератор туда, где находится элемент в
-// контейнере, и логическое значение, обозначающее, имела ли место вставка если
-// вставка не имела место значит ключ такой уже есть
-template <typename T, typename V>
-std::pair<typename map<T, V>::iterator, bool> map<T, V>::insert(
-    const value_type& value) {
-  // если value есть в словаре то возвращем пару: <Итератор на это значение,
-  //  false>
-  if (check_unique(value)) {
-    auto r = this->tree_in_map.Search(value.first);
-    return std::make_pair(iterator(r, tree_in_map.GetRoot()), false);
-  }
-
-  // если нет такого ключа в словаре то вставляем этот ключ
-  this->tree_in_map.Insert(value.first);
-  auto r = this->tree_in_map.Search(value.first);
-  r->val = value.second;
-  return std::make_pair(iterator(r, tree_in_map.GetRoot()), true);
-}
-
-template <typename T, typename V>
-std::pair<typename map<T, V>::iterator, bool> map<T, V>::insert(
-    const key_type& key, const mapped_type& obj) {
-  return insert(std::pair<key_type, mapped_type>(key, obj));
-}
-
-template <typename T, typename V>
-std::pair<typename map<T, V>::iterator, bool> map<T, V>::insert_or_assign(
-    const key_type& key, const mapped_type& obj) {
-  // если елюч уже есть
-  if (check_unique(std::make_pair(key, obj))) {
-    auto r = this->tree_in_map.Search(key);
-    r->val = obj;
-    return std::make_pair(iterator(r, tree_in_map.GetRoot()), true);
-  }
-  // если нет такого ключа в словаре то вставляем этот ключ и значение obj
-  this->tree_in_map.Insert(key);
-  auto r = this->tree_in_map.Search(key);
-  r->val = obj;
-  return std::make_pair(iterator(r, tree_in_map.GetRoot()), true);
-}
-
-template <typename T, typename V>
-void map<T, V>::erase(iterator pos) {
-  if (pos.root_ != nullptr) {
-    this->tree_in_map.Remove(pos.node_->key);
-  }
-}
-
-template <typename T, typename V>
-void map<T, V>::swap(map& other) {
-  tree_in_map.Swap(other.tree_in_map);
-}
-
-template <typename T, typename V>
-void map<T, V>::merge(map& other) {
-  iterator iter = other.begin();
-  while (iter != other.end()) {
-    this->insert(iter.node_->key, iter.node_->val);
-
-    iter++;
-  }
-  this->insert(iter.node_->key, iter.node_->val);
-}
-
-template <typename T, typename V>
-bool map<T, V>::contains(const T& key) {
-  Node<T, V>* node = this->tree_in_map.Search(key);
-  if (node != nullptr) {
-    return true;
-  } else {
-    return false;
-  }
-}
-
-// Вспомогательные методы
-
-// проверяет что переданного ключа нет в словаре
-// возвращает false, если ключа нет
-template <typename T, typename V>
-bool map<T, V>::check_unique(const value_type& value) {
-  if (this->size() > 0) {
-    iterator i = this->begin();
-
-    do {
-      if (value.first == i.node_->key) {
-        return true;
-      }
-      i++;
-    } while (i.node_->is_max == false);
-  }
-  return false;
-}
-}  // namespace s21
-
+#ifndef CPP2_SRC_S21_MAP_H_
+#define CPP2_SRC_S21_MAP_H_
+
+#include <algorithm>  // для std::stable_sort
+#include <iterator>   // для std::reverse_iterator, std::distance
+#include <stdexcept>  // для std::invalid_argument
+#include <utility>    // для std::pair
+
+#include "s21_vector.h"
+#include "tree.h"
+
+namespace s21 {
+template <typename T, typename V, bool Counted = false>
+class map {
+ public:
+  // внутриклассовые переопределения типов (типичные для стандартной библиотеки
+  // STL), принятые для удобства восприятия кода класса:
+  using key_type = T;
+  using mapped_type = V;
+  using default_value = mapped_type&;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using iterator = Iterator<T, V, Counted>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using range_type = Range<T, V, Counted>;
+  using size_type = size_t;
+  // узел, вынутый из словаря через extract
+  using node_type = NodeHandle<T, V, Counted>;
+  // результат insert(node_type&&): если ключ уже был, узел возвращается в
+  // node, а position указывает на элемент с этим ключом
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
+
+  // КОНСТРУКТОРЫ И ДЕСТРУКТОРЫ
+  // создает пустой словарь
+  map();
+
+  // Конструктор - создает словарь с переданными списками
+  map(std::initializer_list<value_type> const& items);
+
+  // Конструктор из диапазона пар в любом порядке: пары сортируются, из
+  // равных ключей остается первый (как при повторных insert), затем дерево
+  // строится за O(n) через assign_sorted. Итого O(n log n) вместо n спусков
+  // с поворотами
+  template <typename InputIt>
+  map(InputIt first, InputIt last);
+
+  // Конструктор копирования
+  map(const map& m);
+  // Конструктор перемещения
+  map(map&& m);
+
+  ~map();
+
+  // ПАРАМЕТРЫ
+ private:
+  Tree<key_type, mapped_type, Counted> tree_in_map;
+
+ public:
+  // геттер к доступу параметра дерева
+  Tree<key_type, mapped_type, Counted> GetTree() { return this->tree_in_map; }
+  map<T, V, Counted>& operator=(map&& m);
+  mapped_type& at(const T& key);
+  // ссылка на значение по ключу; если ключа нет, он вставляется со
+  // значением по умолчанию. Один спуск по дереву
+  mapped_type& operator[](const T& key);
+
+  // возвращает указатель на начало и конец
+  // end() указывает на позицию за последним элементом
+  iterator begin();
+  iterator end();
+  // обход в обратном порядке, от максимального ключа к минимальному
+  reverse_iterator rbegin();
+  reverse_iterator rend();
+
+  void clear();  // очищает словарь
+  bool empty();  // возвращает true, если контейнер пустой
+  size_type size();  // возвращает размер контейнера
+  size_type max_size();  // возвращает максимальный размер контейнера
+
+  // методы для изменения контейнера
+
+  // заменяет содержимое парами из [first, last), которые уже идут по
+  // возрастанию ключа без повторов (это не проверяется). Дерево строится
+  // снизу вверх за O(n), без сравнений ключей
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last);
+
+  // ВСТАВКА УЗЛОВ
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(const T& key, const V& obj);
+  std::pair<iterator, bool> insert_or_assign(const T& key, const V& obj);
+
+  // если ключа нет, вставляет его со значением V(args...), иначе ничего не
+  // делает (args не используются). Один спуск, значение строится прямо в узле
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const T& key, Args&&... args);
+  // то же с подсказкой позиции, возвращает итератор на элемент с ключом.
+  // hint - элемент, перед которым встанет key, или элемент прямо перед ним:
+  // при верной подсказке спуска от корня нет, вставка в среднем O(1).
+  // Для потока по возрастанию подходят end() или результат прошлой вставки
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, const T& key, Args&&... args);
+  iterator insert(iterator hint, const value_type& value);
+
+  // УДАЛЕНИЕ
+  // удаляет элемент pos (узел отцепляется сразу, без повторного поиска по
+  // ключу) и возвращает итератор на следующий
+  iterator erase(iterator pos);
+  // удаляет элемент с ключом key, возвращает число удаленных (0 или 1)
+  size_type erase(const T& key);
+  // удаляет [first, last) за O(k + log n): диапазон вырезается из дерева
+  // целиком и освобождается одним проходом. Возвращает last
+  iterator erase(iterator first, iterator last);
+  // удаляет все элементы, для которых pred(пара) истинен, возвращает их
+  // число. Подряд идущие удаляемые элементы стираются как диапазон
+  template <typename Pred>
+  friend size_type erase_if(map& m, Pred pred) {
+    size_type before = m.size();
+    iterator iter = m.begin();
+    while (iter != m.end()) {
+      if (!pred(*iter)) {
+        ++iter;
+        continue;
+      }
+      iterator last = iter;
+      ++last;
+      while (last != m.end() && pred(*last)) ++last;
+      iter = m.erase(iter, last);
+    }
+    return before - m.size();
+  }
+
+  // ДЕСКРИПТОРЫ УЗЛОВ
+  // вынимает элемент из словаря вместе с узлом, не освобождая память. Для
+  // end() или отсутствующего ключа возвращается пустой дескриптор
+  node_type extract(iterator pos);
+  node_type extract(const T& key);
+  // вставляет вынутый узел (из этого или другого словаря) без выделения
+  // памяти и копирования значения. Ключ узла можно поменять до вставки
+  insert_return_type insert(node_type&& node);
+
+  // смена содержимого контейнера на другое
+  void swap(map& other);
+
+  // слияние передаваемого словаря в первый: узлы other переносятся без
+  // копирования, элементы с ключами, которые здесь уже есть, остаются в other
+  void merge(map& other);
+
+  // РАЗРЕЗ И СОЕДИНЕНИЕ за O(log n), узлы не перевыделяются
+  // переносит элементы с ключами не меньше key в новый словарь и возвращает
+  // его, здесь остаются меньшие (например, orders = orders.split(t)
+  // оставляет записи не старше t)
+  map split(const T& key);
+  // переносит сюда все элементы other, other становится пустым. Ключи other
+  // должны быть все больше или все меньше здешних, иначе бросается
+  // std::invalid_argument и оба словаря не меняются
+  void join(map& other);
+
+  // объединение, пересечение и разность по ключам. Объединение всегда
+  // проходит оба словаря, O(n + m). Пересечение и разность тоже O(n + m),
+  // но если меньший словарь (для разности - a) из m ключей намного меньше,
+  // его ключи ищутся в большем: O(m log n). Если ключ есть в обоих
+  // словарях, значение берется из a
+  friend map set_union(const map& a, const map& b) {
+    map result;
+    result.tree_in_map.AssignUnion(a.tree_in_map, b.tree_in_map);
+    return result;
+  }
+  friend map set_intersection(const map& a, const map& b) {
+    map result;
+    result.tree_in_map.AssignIntersection(a.tree_in_map, b.tree_in_map);
+    return result;
+  }
+  friend map set_difference(const map& a, const map& b) {
+    map result;
+    result.tree_in_map.AssignDifference(a.tree_in_map, b.tree_in_map);
+    return result;
+  }
+
+  bool contains(const T& key);
+  // элемент с ключом key (или end()), один спуск по дереву
+  iterator find(const T& key);
+
+  // ПОИСК ПО ДИАПАЗОНУ КЛЮЧЕЙ
+  // каждый метод - один спуск по дереву за O(log n), дальше обход operator++
+  // первый элемент с ключом не меньше key (или end())
+  iterator lower_bound(const T& key);
+  // первый элемент с ключом строго больше key (или end())
+  iterator upper_bound(const T& key);
+  // пара <lower_bound(key), upper_bound(key)>
+  std::pair<iterator, iterator> equal_range(const T& key);
+  // все элементы с ключами из [lo, hi)
+  range_type range(const T& lo, const T& hi);
+
+  // ПОРЯДКОВАЯ СТАТИСТИКА
+  // только для map<T, V, true>: узлы хранят размер поддерева, поэтому
+  // каждый метод - один проход по высоте дерева, O(log n)
+  // элемент с номером k по возрастанию ключей (с нуля), end() если k >= size
+  iterator nth(size_type k);
+  // число ключей строго меньше key
+  size_type rank(const T& key);
+  // число шагов operator++ от first до last
+  size_type distance(iterator first, iterator last);
+};
+
+// инициализируем пустой словарь где в качестве параметра пустое дерево
+template <typename T, typename V, bool Counted>
+map<T, V, Counted>::map() : tree_in_map() {}
+
+template <typename T, typename V, bool Counted>
+map<T, V, Counted>::map(std::initializer_list<value_type> const& items)
+    : map(items.begin(), items.end()) {}
+
+template <typename T, typename V, bool Counted>
+template <typename InputIt>
+map<T, V, Counted>::map(InputIt first, InputIt last) : map() {
+  Vector<std::pair<key_type, mapped_type>> run;
+  for (; first != last; ++first) {
+    run.push_back(std::pair<key_type, mapped_type>(first->first,
+                                                   first->second));
+  }
+  std::stable_sort(run.begin(), run.end(),
+                   [](const std::pair<key_type, mapped_type>& a,
+                      const std::pair<key_type, mapped_type>& b) {
+                     return a.first < b.first;
+                   });
+  size_type unique = 0;
+  for (size_type i = 0; i < run.size(); ++i) {
+    if (unique == 0 || run[unique - 1].first < run[i].first) {
+      if (unique != i) run[unique] = std::move(run[i]);
+      ++unique;
+    }
+  }
+  tree_in_map.AssignSorted(std::make_move_iterator(run.begin()), unique);
+}
+
+template <typename T, typename V, bool Counted>
+template <typename ForwardIt>
+void map<T, V, Counted>::assign_sorted(ForwardIt first, ForwardIt last) {
+  tree_in_map.AssignSorted(first, std::distance(first, last));
+}
+
+template <typename T, typename V, bool Counted>
+map<T, V, Counted>::map(const map& m) : tree_in_map(m.tree_in_map) {}
+
+template <typename T, typename V, bool Counted>
+map<T, V, Counted>::map(map&& m) : tree_in_map(std::move(m.tree_in_map)) {
+  m.clear();
+}
+
+template <typename T, typename V, bool Counted>
+map<T, V, Counted>::~map() {}
+
+template <typename T, typename V, bool Counted>
+map<T, V, Counted>& map<T, V, Counted>::operator=(map<T, V, Counted>&& m) {
+  if (this != &m) {
+    tree_in_map = std::move(m.tree_in_map);
+  }
+  return *this;
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::mapped_type& map<T, V, Counted>::at(const T& key) {
+  Node<T, V, Counted>* vt = this->tree_in_map.Search(key);
+  if (vt == nullptr) {
+    throw std::out_of_range("s21::map::at: out_of_range");
+  } else {
+    return vt->value.second;
+  }
+}
+
+// InsertUnique - тот же спуск, что и поиск: найденный узел или новый узел
+// со значением по умолчанию
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::mapped_type& map<T, V, Counted>::operator[](
+    const T& key) {
+  return tree_in_map.InsertUnique(key).first->value.second;
+}
+
+template <typename T, typename V, bool Counted>
+bool map<T, V, Counted>::empty() {
+  if (this->tree_in_map.GetSize() == 0) {
+    return true;
+  } else {
+    return false;
+  }
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::size_type map<T, V, Counted>::size() {
+  return this->tree_in_map.GetSize();
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::size_type map<T, V, Counted>::max_size() {
+  return this->tree_in_map.MaxSize();
+}
+
+// методы для итеррирования по элементам контейнера
+// крайние узлы хранятся в заголовке дерева, поэтому все четыре метода O(1)
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::iterator map<T, V, Counted>::begin() {
+  return iterator(tree_in_map.GetFirst(), tree_in_map.GetHeader());
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::iterator map<T, V, Counted>::end() {
+  return iterator(nullptr, tree_in_map.GetHeader());
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::reverse_iterator map<T, V, Counted>::rbegin() {
+  return reverse_iterator(end());
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::reverse_iterator map<T, V, Counted>::rend() {
+  return reverse_iterator(begin());
+}
+
+// методы для изменения контейнера
+
+template <typename T, typename V, bool Counted>
+void map<T, V, Counted>::clear() {
+  this->tree_in_map.ClearTree(tree_in_map.GetRoot());
+}
+
+// вставляет узел и возвращает итератор туда, где находится элемент в
+// контейнере, и логическое значение, обозначающее, имела ли место вставка если
+// вставка не имела место значит ключ такой уже есть
+template <typename T, typename V, bool Counted>
+std::pair<typename map<T, V, Counted>::iterator, bool>
+map<T, V, Counted>::insert(const value_type& value) {
+  // если value есть в словаре то возвращем пару: <Итератор на это значение,
+  //  false>, иначе узел создается сразу с парой <ключ, значение>
+  auto r = this->tree_in_map.InsertUnique(value.first, value.second);
+  return std::make_pair(iterator(r.first, tree_in_map.GetHeader()), r.second);
+}
+
+template <typename T, typename V, bool Counted>
+std::pair<typename map<T, V, Counted>::iterator, bool>
+map<T, V, Counted>::insert(const key_type& key,
+                           const mapped_type& obj) {
+  return insert(std::pair<key_type, mapped_type>(key, obj));
+}
+
+template <typename T, typename V, bool Counted>
+std::pair<typename map<T, V, Counted>::iterator, bool>
+map<T, V, Counted>::insert_or_assign(const key_type& key,
+                                     const mapped_type& obj) {
+  // если ключ уже есть, то просто меняем значение
+  // если нет такого ключа в словаре то вставляем этот ключ и значение obj
+  auto r = this->tree_in_map.InsertUnique(key, obj);
+  if (!r.second) r.first->value.second = obj;
+  return std::make_pair(iterator(r.first, tree_in_map.GetHeader()), true);
+}
+
+template <typename T, typename V, bool Counted>
+template <typename... Args>
+std::pair<typename map<T, V, Counted>::iterator, bool>
+map<T, V, Counted>::try_emplace(const T& key, Args&&... args) {
+  auto r = tree_in_map.InsertUnique(key, std::forward<Args>(args)...);
+  return std::make_pair(iterator(r.first, tree_in_map.GetHeader()), r.second);
+}
+
+template <typename T, typename V, bool Counted>
+template <typename... Args>
+typename map<T, V, Counted>::iterator map<T, V, Counted>::emplace_hint(
+    iterator hint, const T& key, Args&&... args) {
+  auto r = tree_in_map.InsertUniqueHint(hint.node_, key,
+                                        std::forward<Args>(args)...);
+  return iterator(r.first, tree_in_map.GetHeader());
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::iterator map<T, V, Counted>::insert(
+    iterator hint, const value_type& value) {
+  return emplace_hint(hint, value.first, value.second);
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::iterator map<T, V, Counted>::erase(
+    iterator pos) {
+  if (pos.node_ == nullptr) return pos;
+  iterator next = pos;
+  ++next;
+  tree_in_map.RemoveNode(pos.node_);
+  return next;
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::size_type map<T, V, Counted>::erase(
+    const T& key) {
+  Node<T, V, Counted>* node = tree_in_map.Search(key);
+  if (node == nullptr) return 0;
+  tree_in_map.RemoveNode(node);
+  return 1;
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::iterator map<T, V, Counted>::erase(
+    iterator first, iterator last) {
+  if (first.node_ == nullptr) return last;
+  tree_in_map.RemoveRange(first.node_, last.node_);
+  return last;
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::node_type map<T, V, Counted>::extract(
+    iterator pos) {
+  if (pos.node_ == nullptr) return node_type();
+  return node_type(tree_in_map.Extract(pos.node_));
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::node_type map<T, V, Counted>::extract(
+    const T& key) {
+  return extract(iterator(tree_in_map.Search(key), tree_in_map.GetHeader()));
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::insert_return_type map<T, V, Counted>::insert(
+    node_type&& node) {
+  if (node.empty()) return insert_return_type{end(), false, node_type()};
+  auto r = tree_in_map.Reinsert(node.Get(), true);
+  iterator position(r.first, tree_in_map.GetHeader());
+  // узел принадлежит дереву только после успешной вставки
+  if (!r.second) return insert_return_type{position, false, std::move(node)};
+  node.Release();
+  return insert_return_type{position, true, node_type()};
+}
+
+template <typename T, typename V, bool Counted>
+void map<T, V, Counted>::swap(map& other) {
+  tree_in_map.Swap(other.tree_in_map);
+}
+
+template <typename T, typename V, bool Counted>
+void map<T, V, Counted>::merge(map& other) {
+  tree_in_map.Merge(other.tree_in_map, true);
+}
+
+template <typename T, typename V, bool Counted>
+map<T, V, Counted> map<T, V, Counted>::split(const T& key) {
+  map greater;
+  tree_in_map.Split(key, greater.tree_in_map);
+  return greater;
+}
+
+template <typename T, typename V, bool Counted>
+void map<T, V, Counted>::join(map& other) {
+  if (!tree_in_map.Join(other.tree_in_map, true)) {
+    throw std::invalid_argument("s21::map::join: key ranges overlap");
+  }
+}
+
+template <typename T, typename V, bool Counted>
+bool map<T, V, Counted>::contains(const T& key) {
+  Node<T, V, Counted>* node = this->tree_in_map.Search(key);
+  if (node != nullptr) {
+    return true;
+  } else {
+    return false;
+  }
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::iterator map<T, V, Counted>::find(const T& key) {
+  return iterator(tree_in_map.Search(key), tree_in_map.GetHeader());
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::iterator map<T, V, Counted>::lower_bound(
+    const T& key) {
+  return iterator(tree_in_map.LowerBound(key), tree_in_map.GetHeader());
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::iterator map<T, V, Counted>::upper_bound(
+    const T& key) {
+  return iterator(tree_in_map.UpperBound(key), tree_in_map.GetHeader());
+}
+
+template <typename T, typename V, bool Counted>
+std::pair<typename map<T, V, Counted>::iterator,
+          typename map<T, V, Counted>::iterator>
+map<T, V, Counted>::equal_range(const T& key) {
+  return std::make_pair(lower_bound(key), upper_bound(key));
+}
+
+// при hi <= lo диапазон пустой
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::range_type map<T, V, Counted>::range(
+    const T& lo, const T& hi) {
+  if (!(lo < hi)) {
+    return range_type(end(), end());
+  }
+  return range_type(lower_bound(lo), lower_bound(hi));
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::iterator map<T, V, Counted>::nth(size_type k) {
+  return iterator(tree_in_map.Nth(k), tree_in_map.GetHeader());
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::size_type map<T, V, Counted>::rank(const T& key) {
+  return tree_in_map.Rank(key);
+}
+
+template <typename T, typename V, bool Counted>
+typename map<T, V, Counted>::size_type map<T, V, Counted>::distance(
+    iterator first, iterator last) {
+  return tree_in_map.Index(last.node_) - tree_in_map.Index(first.node_);
+}
+}  // namespace s21
+
 #endif  // CPP2_SRC_S21_MAP_H_
\ No newline at end of file
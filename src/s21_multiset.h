@@ -0,0 +1,149 @@
+#ifndef CPP2_SRC_S21_MULTISET_H_
+#define CPP2_SRC_S21_MULTISET_H_
+
+#include <initializer_list>
+#include <iterator>  // для std::reverse_iterator
+#include <utility>   // для std::pair
+
+#include "tree.h"
+
+namespace s21 {
+
+template <typename Key>
+class multiset {
+ public:
+  // attributes
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using tree_type = Tree<key_type>;
+  using iterator = Iterator<key_type>;
+  using const_iterator = Iterator<key_type>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using size_type = std::size_t;
+
+  multiset() : tree_() {}
+
+  multiset(std::initializer_list<value_type> const &items) : multiset() {
+    for (const_reference item : items) insert(item);
+  }
+
+  multiset(const multiset &other) : tree_(other.tree_) {}
+  multiset(multiset &&other) : tree_(std::move(other.tree_)) { other.clear(); }
+
+  ~multiset() {}
+
+  // operator overload
+
+  multiset &operator=(const multiset &other) {
+    if (this != &other) tree_ = tree_type(other.tree_);
+    return *this;
+  }
+
+  multiset &operator=(multiset &&other) {
+    tree_ = std::move(other.tree_);
+    return *this;
+  }
+
+  // iterators
+
+  iterator begin() { return iterator(tree_.GetFirst(), tree_.GetHeader()); }
+
+  iterator end() { return iterator(nullptr, tree_.GetHeader()); }
+
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+
+  // capacity
+
+  bool empty() { return tree_.GetSize() == 0; }
+
+  size_type size() { return tree_.GetSize(); }
+
+  size_type max_size() { return tree_.MaxSize(); }
+
+  // modifiers
+
+  void clear() { tree_.ClearTree(tree_.GetRoot()); }
+
+  // одинаковые ключи не копируются в отдельные контейнеры: каждый хранится в
+  // своем узле дерева, новый встает после уже имеющихся равных
+  iterator insert(const value_type &value) {
+    return iterator(tree_.InsertMulti(value), tree_.GetHeader());
+  }
+
+  // удаляет ровно тот элемент, на который указывает итератор, возвращает
+  // итератор на следующий
+  iterator erase(iterator pos) {
+    if (pos.node_ == nullptr) return pos;
+    iterator next = pos;
+    ++next;
+    tree_.RemoveNode(pos.node_);
+    return next;
+  }
+  // удаляет все ключи, равные key, одним диапазоном; возвращает их число
+  size_type erase(const key_type &key) {
+    size_type before = size();
+    erase(lower_bound(key), upper_bound(key));
+    return before - size();
+  }
+  // удаляет [first, last), в том числе часть равных ключей, возвращает last
+  iterator erase(iterator first, iterator last) {
+    if (first.node_ == nullptr) return last;
+    tree_.RemoveRange(first.node_, last.node_);
+    return last;
+  }
+
+  void swap(multiset &other) { tree_.Swap(other.tree_); }
+
+  // переносит все узлы other в текущее мультимножество без копирования,
+  // other становится пустым
+  void merge(multiset &other) { tree_.Merge(other.tree_, false); }
+
+  // lookup
+
+  // число элементов с ключом key: O(log n + count)
+  size_type count(const Key &key) {
+    size_type result = 0;
+    for (iterator iter = lower_bound(key); iter != end() && !(key < *iter);
+         ++iter) {
+      ++result;
+    }
+    return result;
+  }
+
+  // первый из равных ключей, или end()
+  iterator find(const Key &key) {
+    iterator iter = lower_bound(key);
+    if (iter != end() && !(key < *iter)) {
+      return iter;
+    }
+    return end();
+  }
+
+  bool contains(const Key &key) { return tree_.Search(key) != nullptr; }
+
+  std::pair<iterator, iterator> equal_range(const Key &key) {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+  // первый элемент не меньше key
+  iterator lower_bound(const Key &key) {
+    return iterator(tree_.LowerBound(key), tree_.GetHeader());
+  }
+
+  // первый элемент строго больше key
+  iterator upper_bound(const Key &key) {
+    return iterator(tree_.UpperBound(key), tree_.GetHeader());
+  }
+
+  Tree<key_type> &GetTree() { return this->tree_; }
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_MULTISET_H_
@@ -0,0 +1,127 @@
+#ifndef CPP2_SRC_S21_PERSISTENT_MAP_H_
+#define CPP2_SRC_S21_PERSISTENT_MAP_H_
+
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>  // для std::pair
+
+#include "persistent_tree.h"
+
+namespace s21 {
+
+/*
+Ordered dictionary with the s21::map interface and O(1) snapshots. Copying a
+persistent_map (or calling snapshot()) shares the whole tree; a later write
+copies only the O(log n) nodes on its path and leaves the snapshot intact,
+so a reader can iterate a snapshot on another thread while the owner keeps
+writing, without locks. Without live snapshots writes change nodes in place.
+Elements are read-only through iterators and at(): write with insert,
+insert_or_assign and erase. A write invalidates iterators of this map, not
+of its snapshots. Take snapshots from the writing thread.
+ */
+template <typename Key, typename T>
+class persistent_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using tree_type = PersistentTree<key_type, mapped_type>;
+  using iterator = PersistentIterator<key_type, mapped_type>;
+  using const_iterator = PersistentIterator<key_type, mapped_type>;
+  using size_type = std::size_t;
+
+  persistent_map() : tree_() {}
+
+  persistent_map(std::initializer_list<value_type> const &items)
+      : persistent_map() {
+    for (const_reference item : items) insert(item);
+  }
+
+  // копия - это снимок: O(1), узлы общие
+  persistent_map(const persistent_map &other) : tree_(other.tree_) {}
+  persistent_map(persistent_map &&other) : tree_(std::move(other.tree_)) {}
+
+  ~persistent_map() {}
+
+  persistent_map &operator=(const persistent_map &other) {
+    tree_ = other.tree_;
+    return *this;
+  }
+  persistent_map &operator=(persistent_map &&other) {
+    tree_ = std::move(other.tree_);
+    return *this;
+  }
+
+  // неизменяемая версия текущего содержимого, O(1)
+  persistent_map snapshot() const { return *this; }
+
+  // element access
+
+  const mapped_type &at(const key_type &key) const {
+    auto node = tree_.Search(key);
+    if (node == nullptr) {
+      throw std::out_of_range("s21::persistent_map::at: out_of_range");
+    }
+    return node->value.second;
+  }
+
+  // iterators
+
+  iterator begin() const { return iterator(tree_.GetRoot()); }
+  iterator end() const { return iterator(); }
+
+  // capacity
+
+  bool empty() const { return tree_.GetSize() == 0; }
+  size_type size() const { return tree_.GetSize(); }
+  size_type max_size() const { return tree_.MaxSize(); }
+
+  // modifiers
+
+  void clear() { tree_.Clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    bool inserted = tree_.Insert(key, false, obj);
+    return std::make_pair(lower_bound(key), inserted);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    bool inserted = tree_.Insert(key, true, obj);
+    return std::make_pair(lower_bound(key), inserted);
+  }
+
+  // возвращает число удаленных элементов (0 или 1)
+  size_type erase(const key_type &key) { return tree_.Remove(key) ? 1 : 0; }
+
+  void swap(persistent_map &other) { tree_.Swap(other.tree_); }
+
+  // lookup
+
+  bool contains(const key_type &key) const {
+    return tree_.Search(key) != nullptr;
+  }
+
+  iterator find(const key_type &key) const {
+    iterator pos = lower_bound(key);
+    return pos != end() && !(key < pos->first) ? pos : end();
+  }
+
+  iterator lower_bound(const key_type &key) const {
+    return iterator(tree_.GetRoot(), key);
+  }
+
+ private:
+  tree_type tree_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_PERSISTENT_MAP_H_
@@ -0,0 +1,210 @@
+#ifndef CPP2_SRC_S21_PRIORITY_QUEUE_H_
+#define CPP2_SRC_S21_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <functional>  // for std::less
+#include <initializer_list>
+#include <utility>
+
+#include "s21_vector.h"
+#include "stdexcept"
+
+namespace s21 {
+
+/*
+Container adaptor that keeps its elements as an implicit d-ary heap inside a
+random access container. The element with the highest priority (the "largest"
+one according to Compare) is always at index 0.
+
+Arity is the number of children of each heap node: 2 gives the classic binary
+heap, 4 keeps all children of a node in one cache line for small T and makes
+the heap twice as shallow, at the price of more comparisons per level.
+
+Container must provide operator[], size(), empty(), push_back(), pop_back(),
+back() and swap() (s21::Vector and std::vector do).
+ */
+template <typename T, typename Container = s21::Vector<T>,
+          typename Compare = std::less<typename Container::value_type>,
+          std::size_t Arity = 2>
+class PriorityQueue {
+  static_assert(Arity >= 2, "PriorityQueue: Arity must be at least 2");
+
+ public:
+  // attributes
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = typename Container::value_type;
+  using reference = typename Container::reference;
+  using const_reference = typename Container::const_reference;
+  using size_type = typename Container::size_type;
+
+  PriorityQueue() : container(), comp() {}
+
+  explicit PriorityQueue(const Compare &compare) : container(), comp(compare) {}
+
+  /*
+  Builds the heap from the whole list at once: the elements are copied into the
+  container in their original order and then heapified in O(n), which is
+  cheaper than n consecutive pushes (O(n log n)).
+   */
+  PriorityQueue(std::initializer_list<value_type> const &items,
+                const Compare &compare = Compare())
+      : container(), comp(compare) {
+    for (const_reference item : items) {
+      container.push_back(item);
+    }
+    MakeHeap();
+  }
+
+  /*
+  Same as above for an arbitrary input range [first, last).
+   */
+  template <typename InputIt>
+  PriorityQueue(InputIt first, InputIt last,
+                const Compare &compare = Compare())
+      : container(), comp(compare) {
+    for (; first != last; ++first) {
+      container.push_back(*first);
+    }
+    MakeHeap();
+  }
+
+  PriorityQueue(const PriorityQueue &q)
+      : container(q.container), comp(q.comp) {}
+
+  PriorityQueue(PriorityQueue &&q) noexcept
+      : container(std::move(q.container)), comp(std::move(q.comp)) {}
+
+  PriorityQueue &operator=(const PriorityQueue &q) {
+    if (this != &q) {
+      container = q.container;
+      comp = q.comp;
+    }
+    return *this;
+  }
+
+  PriorityQueue &operator=(PriorityQueue &&q) noexcept {
+    container = std::move(q.container);
+    comp = std::move(q.comp);
+    return *this;
+  }
+
+  ~PriorityQueue() = default;
+
+  /*
+  Returns a reference to the element with the highest priority.
+  Calling top on an empty queue causes undefined behavior.
+   */
+  const_reference top() const { return container[0]; }
+
+  /*
+  Checks if the container has no elements.
+  */
+  bool empty() const noexcept { return container.empty(); }
+
+  /*
+  Returns the number of elements in the container.
+  */
+  size_type size() const noexcept { return container.size(); }
+
+  /*
+  Appends the element to the end of the container and lifts it up to its place
+  in O(log n).
+   */
+  void push(const_reference value) {
+    container.push_back(value);
+    SiftUp(container.size() - 1);
+  }
+
+  /*
+  Constructs the element from args and inserts it like push().
+   */
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    push(value_type(std::forward<Args>(args)...));
+  }
+
+  /*
+  Removes the top element: the last element takes its place and is sifted down
+  in O(log n). Calling pop on an empty queue causes undefined behavior.
+   */
+  void pop() {
+    if (container.size() > 1) {
+      value_type last = std::move(container.back());
+      container.pop_back();
+      SiftDown(0, std::move(last));
+    } else {
+      container.pop_back();
+    }
+  }
+
+  /*
+  Exchanges the contents of the container with those of others. Does not invoke
+  any move, copy, or swap operations on individual elements.
+   */
+  void swap(PriorityQueue &other) {
+    container.swap(other.container);
+    std::swap(comp, other.comp);
+  }
+
+ private:
+  Container container;
+  Compare comp;
+
+  // support
+  static size_type Parent(size_type pos) { return (pos - 1) / Arity; }
+  static size_type FirstChild(size_type pos) { return pos * Arity + 1; }
+
+  // Floyd's bottom-up heap construction: sifting down every inner node starting
+  // from the last one costs O(n) in total
+  void MakeHeap() {
+    size_type n = container.size();
+    if (n < 2) {
+      return;
+    }
+    for (size_type pos = Parent(n - 1) + 1; pos-- > 0;) {
+      value_type value = std::move(container[pos]);
+      SiftDown(pos, std::move(value));
+    }
+  }
+
+  // the element is not swapped on every level: parents are moved down into the
+  // "hole" and the element is written once, at its final position
+  void SiftUp(size_type pos) {
+    value_type value = std::move(container[pos]);
+    while (pos > 0) {
+      size_type parent = Parent(pos);
+      if (!comp(container[parent], value)) {
+        break;
+      }
+      container[pos] = std::move(container[parent]);
+      pos = parent;
+    }
+    container[pos] = std::move(value);
+  }
+
+  // places value into the hole at pos, moving the best child up while it has a
+  // higher priority than value
+  void SiftDown(size_type pos, value_type value) {
+    size_type n = container.size();
+    for (size_type child = FirstChild(pos); child < n;
+         child = FirstChild(pos)) {
+      size_type best = child;
+      size_type last = child + Arity < n ? child + Arity : n;
+      for (size_type i = child + 1; i < last; ++i) {
+        if (comp(container[best], container[i])) {
+          best = i;
+        }
+      }
+      if (!comp(value, container[best])) {
+        break;
+      }
+      container[pos] = std::move(container[best]);
+      pos = best;
+    }
+    container[pos] = std::move(value);
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_PRIORITY_QUEUE_H_
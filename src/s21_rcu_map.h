@@ -0,0 +1,152 @@
+#ifndef CPP2_SRC_S21_RCU_MAP_H_
+#define CPP2_SRC_S21_RCU_MAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <exception>  // для std::uncaught_exceptions
+#include <initializer_list>
+#include <memory>  // для std::default_delete
+#include <mutex>
+#include <utility>  // для std::pair
+
+#include "epoch.h"
+#include "s21_persistent_map.h"
+
+namespace s21 {
+
+/*
+Read-mostly ordered map for many reader threads and rare writers. Readers
+never lock: a lookup reads the current version through an atomic pointer.
+A write builds the next version from the current one and publishes it with
+one atomic store. Versions are persistent_map snapshots, so a version costs
+O(log n) new nodes per changed key instead of a copy of the whole tree.
+
+A replaced version is freed by an EpochDomain (epoch.h) once no reader can
+still hold it. Readers only bump a counter in a per-thread slot on its own
+cache line, so readers on different cores do not write to a shared line the
+way a reader-writer lock does. Writers are serialized by a mutex but never
+wait for readers: a reader preempted inside read() only delays freeing.
+Several changes made in one update() are published together.
+ */
+template <typename Key, typename T>
+class rcu_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using version_type = persistent_map<key_type, mapped_type>;
+  using size_type = std::size_t;
+
+  rcu_map() : current_(new version_type()) {}
+
+  rcu_map(std::initializer_list<value_type> const &items)
+      : current_(new version_type(items)) {}
+
+  rcu_map(const rcu_map &) = delete;
+  rcu_map &operator=(const rcu_map &) = delete;
+
+  // читателей в момент удаления быть не должно
+  ~rcu_map() { delete current_.load(std::memory_order_relaxed); }
+
+  // READERS: без блокировок
+
+  // вызывает func(const version_type &) для версии, актуальной на момент
+  // входа; версия не меняется и не удаляется, пока func работает. Ссылки
+  // на элементы версии действительны только внутри func
+  template <typename Func>
+  auto read(Func func) const {
+    EpochGuard guard = domain_.Pin();
+    return func(*current_.load(std::memory_order_seq_cst));
+  }
+
+  bool contains(const key_type &key) const {
+    return read(
+        [&key](const version_type &map) { return map.contains(key); });
+  }
+
+  // копирует значение в out, если ключ есть
+  bool find(const key_type &key, mapped_type &out) const {
+    return read([&key, &out](const version_type &map) {
+      // find() строит путь итератора, два спуска дешевле
+      if (!map.contains(key)) return false;
+      out = map.at(key);
+      return true;
+    });
+  }
+
+  size_type size() const {
+    return read([](const version_type &map) { return map.size(); });
+  }
+
+  bool empty() const { return size() == 0; }
+
+  // неизменяемый снимок текущей версии, его можно хранить сколько угодно
+  version_type snapshot() const {
+    return read([](const version_type &map) { return map.snapshot(); });
+  }
+
+  // WRITERS: по одному, версии публикуются атомарно
+
+  // func(version_type &) меняет следующую версию; все ее изменения читатели
+  // увидят одновременно. Возвращает результат func. Если func бросила
+  // исключение, версия не публикуется и читатели не видят ни одного
+  // изменения
+  template <typename Func>
+  auto update(Func func) {
+    std::lock_guard<std::mutex> lock(writer_);
+    domain_.Reserve(1);  // деструктор Publish не бросает
+    Publish publish(*this);
+    return func(*publish.next);
+  }
+
+  bool insert(const key_type &key, const mapped_type &obj) {
+    return update(
+        [&](version_type &map) { return map.insert(key, obj).second; });
+  }
+
+  bool insert_or_assign(const key_type &key, const mapped_type &obj) {
+    return update([&](version_type &map) {
+      return map.insert_or_assign(key, obj).second;
+    });
+  }
+
+  size_type erase(const key_type &key) {
+    return update([&key](version_type &map) { return map.erase(key); });
+  }
+
+  void clear() {
+    update([](version_type &map) { map.clear(); });
+  }
+
+ private:
+  // следующая версия: копия текущей за O(1), публикуется в деструкторе,
+  // если он вызван не из-за исключения
+  struct Publish {
+    explicit Publish(rcu_map &map)
+        : self(map),
+          old(map.current_.load(std::memory_order_relaxed)),
+          next(new version_type(*old)),
+          exceptions(std::uncaught_exceptions()) {}
+    ~Publish() {
+      if (std::uncaught_exceptions() > exceptions) {
+        delete next;
+        return;
+      }
+      self.current_.store(next, std::memory_order_seq_cst);
+      self.domain_.Retire(old);
+    }
+
+    rcu_map &self;
+    version_type *old;
+    version_type *next;
+    int exceptions;
+  };
+
+  std::atomic<version_type *> current_;
+  EpochDomain<version_type, std::default_delete<version_type>> domain_;
+  std::mutex writer_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_RCU_MAP_H_
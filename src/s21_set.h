@@ -1,166 +1,295 @@
-#ifndef CPP2_SRC_S21_SET_H_
-#define CPP2_SRC_S21_SET_H_
-
-#include <initializer_list>
-#include <utility>  // для std::pair
-
-#include "tree.h"
-
-namespace s21 {
-
-template <typename Key>
-class set {
- public:
-  // attributes
-  using key_type = Key;
-  using value_type = Key;
-  using reference = value_type &;
-  using const_reference = const value_type &;
-  using tree_type = Tree<key_type, value_type>;
-  using node_type = std::pair<const key_type, value_type>;
-  using iterator = Iterator<key_type, value_type>;
-  using const_iterator = Iterator<key_type, value_type>;
-  using size_type = std::size_t;
-
-  set() : tree_() {}
-
-  set(const set &other) : tree_(other.tree_) {}
-  set(set &&other) : tree_(std::move(other.tree_)) { other.clear(); }
-
-  ~set() {}
-
-  std::pair<iterator, bool> insert(const value_type &value) {
-    // если value есть в словаре то возвращем пару: <Итератор на это значение,
-    //  false>
-    if (check_unique(value)) {
-      auto r = this->tree_.Search(value);
-      return std::make_pair(iterator(r, tree_.GetRoot()), false);
-    }
-
-    // если нет такого ключа в словаре то вставляем этот ключ
-    this->tree_.Insert(value);
-    auto r = this->tree_.Search(value);
-    r->val = value;
-    return std::make_pair(iterator(r, tree_.GetRoot()), true);
-  }
-
-  set(std::initializer_list<value_type> const &items) : set() {
-    for (value_type i : items) insert(i);
-  }
-
-  // iterators
-
-  iterator begin() noexcept {
-    Node<key_type, value_type> *node = this->tree_.GetRoot();
-    while (node->left != nullptr) {
-      node = node->left;
-    }
-    return iterator(node, tree_.GetRoot());
-  }
-
-  const_iterator begin() const noexcept {
-    Node<key_type, value_type> *node = this->tree_.GetRoot();
-    while (node->left != nullptr) {
-      node = node->left;
-    }
-    return iterator(node, tree_.GetRoot());
-  }
-
-  iterator end() noexcept {
-    Node<key_type, value_type> *node = tree_.GetRoot();
-    while (node->right != nullptr) {
-      node = node->right;
-    }
-    return iterator(node, tree_.GetRoot());
-  }
-
-  const_iterator end() const noexcept {
-    Node<key_type, value_type> *node = tree_.GetRoot();
-    while (node->right != nullptr) {
-      node = node->right;
-    }
-    return iterator(node, tree_.GetRoot());
-  }
-
-  iterator find(const key_type &key) noexcept { return tree_.Search(key); }
-
-  const_iterator find(const key_type &key) const { return tree_.Search(key); }
-
-  bool contains(const Key &key) {
-    Node<key_type, value_type> *node = this->tree_.Search(key);
-    if (node != nullptr) {
-      return true;
-    } else {
-      return false;
-    }
-  }
-
-  void swap(set &other) { tree_.Swap(other.tree_); }
-
-  void merge(set &other) {
-    iterator iter = other.begin();
-    while (iter != other.end()) {
-      this->insert(iter.node_->key);
-
-      iter++;
-    }
-    this->insert(iter.node_->key);
-  }
-
-  bool empty() {
-    if (this->tree_.GetSize() == 0) {
-      return true;
-    } else {
-      return false;
-    }
-  }
-
-  size_type size() noexcept { return this->tree_.GetSize(); }
-
-  size_type max_size() noexcept { return this->tree_.MaxSize(); }
-
-  void clear() { tree_.ClearTree(tree_.GetRoot()); };
-
-  // operator overload
-
-  set &operator=(const set &other) {
-    *tree_ = *other.tree_;
-    return *this;
-  }
-
-  set &operator=(set &&other) noexcept {
-    *tree_ = std::move(*other.tree_);
-    return *this;
-  }
-
-  void erase(iterator pos) {
-    if (pos.root_ != nullptr) {
-      this->tree_.Remove(pos.node_->key);
-    }
-  }
-
-  Tree<key_type, value_type> GetTree() { return this->tree_; }
-
- private:
-  tree_type tree_;
-
-  // Вспомогательные методы
-  // проверяет что переданного ключа нет в словаре
-  // возвращает false, если ключа нет
-  bool check_unique(const value_type &value) {
-    if (this->size() > 0) {
-      iterator i = this->begin();
-
-      do {
-        if (value == i.node_->key) {
-          return true;
-        }
-        i++;
-      } while (i.node_->is_max == false);
-    }
-    return false;
-  }
-};
-}  // namespace s21
-
+#ifndef CPP2_SRC_S21_SET_H_
+#define CPP2_SRC_S21_SET_H_
+
+#include <algorithm>  // для std::sort
+#include <initializer_list>
+#include <iterator>   // для std::reverse_iterator, std::distance
+#include <stdexcept>  // для std::invalid_argument
+#include <utility>    // для std::pair
+
+#include "s21_vector.h"
+#include "tree.h"
+
+namespace s21 {
+
+template <typename Key, bool Counted = false>
+class set {
+ public:
+  // attributes
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using tree_type = Tree<key_type, void, Counted>;
+  using iterator = Iterator<key_type, void, Counted>;
+  using const_iterator = Iterator<key_type, void, Counted>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using range_type = Range<key_type, void, Counted>;
+  using size_type = std::size_t;
+  // узел, вынутый из множества через extract
+  using node_type = NodeHandle<key_type, void, Counted>;
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;  // узел, если такой ключ уже был
+  };
+
+  set() : tree_() {}
+
+  set(const set &other) : tree_(other.tree_) {}
+  set(set &&other) : tree_(std::move(other.tree_)) { other.clear(); }
+
+  ~set() {}
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    // если value есть в словаре то возвращем пару: <Итератор на это значение,
+    //  false>, иначе вставляем этот ключ
+    auto r = this->tree_.InsertUnique(value);
+    return std::make_pair(iterator(r.first, tree_.GetHeader()), r.second);
+  }
+
+  // вставка с подсказкой: hint - элемент, перед которым встанет value, или
+  // элемент прямо перед ним; при верной подсказке без спуска от корня
+  iterator insert(iterator hint, const value_type &value) {
+    auto r = tree_.InsertUniqueHint(hint.node_, value);
+    return iterator(r.first, tree_.GetHeader());
+  }
+
+  set(std::initializer_list<value_type> const &items)
+      : set(items.begin(), items.end()) {}
+
+  // построение из неотсортированных данных: сортировка, удаление повторов и
+  // сборка дерева снизу вверх за O(n) - всего O(n log n)
+  template <typename InputIt>
+  set(InputIt first, InputIt last) : set() {
+    Vector<key_type> run;
+    for (; first != last; ++first) run.push_back(*first);
+    std::sort(run.begin(), run.end());
+    size_type unique = 0;
+    for (size_type i = 0; i < run.size(); ++i) {
+      if (unique == 0 || run[unique - 1] < run[i]) {
+        if (unique != i) run[unique] = std::move(run[i]);
+        ++unique;
+      }
+    }
+    tree_.AssignSorted(std::make_move_iterator(run.begin()), unique);
+  }
+
+  // заменяет содержимое на [first, last), ключи должны уже строго
+  // возрастать (это не проверяется); O(n) без сравнений ключей
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last) {
+    tree_.AssignSorted(first, std::distance(first, last));
+  }
+
+  // iterators
+
+  // наименьший и наибольший узлы хранятся в заголовке дерева: O(1)
+  iterator begin() noexcept {
+    return iterator(tree_.GetFirst(), tree_.GetHeader());
+  }
+
+  const_iterator begin() const noexcept {
+    return iterator(tree_.GetFirst(), tree_.GetHeader());
+  }
+
+  // end() указывает на позицию за последним элементом
+  iterator end() noexcept { return iterator(nullptr, tree_.GetHeader()); }
+
+  const_iterator end() const noexcept {
+    return iterator(nullptr, tree_.GetHeader());
+  }
+
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+
+  iterator find(const key_type &key) noexcept {
+    return iterator(tree_.Search(key), tree_.GetHeader());
+  }
+
+  // поиск по диапазону: один спуск за O(log n), дальше operator++
+
+  // первый элемент не меньше key (или end())
+  iterator lower_bound(const key_type &key) {
+    return iterator(tree_.LowerBound(key), tree_.GetHeader());
+  }
+
+  // первый элемент строго больше key (или end())
+  iterator upper_bound(const key_type &key) {
+    return iterator(tree_.UpperBound(key), tree_.GetHeader());
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+  // все элементы из [lo, hi), при hi <= lo диапазон пустой
+  range_type range(const key_type &lo, const key_type &hi) {
+    if (!(lo < hi)) {
+      return range_type(end(), end());
+    }
+    return range_type(lower_bound(lo), lower_bound(hi));
+  }
+
+  // порядковые статистики, только для set<Key, true> (узлы хранят размеры
+  // поддеревьев): один проход по высоте дерева, O(log n)
+
+  // k-й по возрастанию элемент, считая с нуля, или end(), если k >= size()
+  iterator nth(size_type k) {
+    return iterator(tree_.Nth(k), tree_.GetHeader());
+  }
+
+  // число элементов строго меньше key
+  size_type rank(const key_type &key) { return tree_.Rank(key); }
+
+  // число шагов operator++ от first до last
+  size_type distance(iterator first, iterator last) {
+    return tree_.Index(last.node_) - tree_.Index(first.node_);
+  }
+
+  bool contains(const Key &key) {
+    Node<key_type, void, Counted> *node = this->tree_.Search(key);
+    if (node != nullptr) {
+      return true;
+    } else {
+      return false;
+    }
+  }
+
+  void swap(set &other) { tree_.Swap(other.tree_); }
+
+  // переносит узлы other без копирования; ключи, которые здесь уже есть,
+  // остаются в other, как у std::set::merge
+  void merge(set &other) { tree_.Merge(other.tree_, true); }
+
+  // объединение, пересечение и разность. Объединение всегда проходит оба
+  // множества, O(n + m). Пересечение и разность тоже O(n + m), но если
+  // меньшее множество (для разности - a) из m ключей намного меньше, его
+  // ключи ищутся в большем: O(m log n)
+  friend set set_union(const set &a, const set &b) {
+    set result;
+    result.tree_.AssignUnion(a.tree_, b.tree_);
+    return result;
+  }
+  friend set set_intersection(const set &a, const set &b) {
+    set result;
+    result.tree_.AssignIntersection(a.tree_, b.tree_);
+    return result;
+  }
+  friend set set_difference(const set &a, const set &b) {
+    set result;
+    result.tree_.AssignDifference(a.tree_, b.tree_);
+    return result;
+  }
+
+  bool empty() {
+    if (this->tree_.GetSize() == 0) {
+      return true;
+    } else {
+      return false;
+    }
+  }
+
+  size_type size() noexcept { return this->tree_.GetSize(); }
+
+  size_type max_size() noexcept { return this->tree_.MaxSize(); }
+
+  void clear() { tree_.ClearTree(tree_.GetRoot()); };
+
+  // operator overload
+
+  set &operator=(const set &other) {
+    if (this != &other) tree_ = tree_type(other.tree_);
+    return *this;
+  }
+
+  set &operator=(set &&other) noexcept {
+    tree_ = std::move(other.tree_);
+    return *this;
+  }
+
+  // разрез и соединение за O(log n), узлы не перевыделяются: split
+  // переносит ключи не меньше key в новое множество, join забирает все
+  // ключи other, которые должны быть все больше или все меньше здешних
+  // (иначе std::invalid_argument, оба множества не меняются)
+  set split(const key_type &key) {
+    set greater;
+    tree_.Split(key, greater.tree_);
+    return greater;
+  }
+  void join(set &other) {
+    if (!tree_.Join(other.tree_, true)) {
+      throw std::invalid_argument("s21::set::join: key ranges overlap");
+    }
+  }
+
+  // удаляет элемент pos без повторного поиска по ключу, возвращает
+  // итератор на следующий
+  iterator erase(iterator pos) {
+    if (pos.node_ == nullptr) return pos;
+    iterator next = pos;
+    ++next;
+    tree_.RemoveNode(pos.node_);
+    return next;
+  }
+  // возвращает число удаленных ключей (0 или 1)
+  size_type erase(const key_type &key) {
+    Node<key_type, void, Counted> *node = tree_.Search(key);
+    if (node == nullptr) return 0;
+    tree_.RemoveNode(node);
+    return 1;
+  }
+  // удаляет [first, last) за O(k + log n), возвращает last
+  iterator erase(iterator first, iterator last) {
+    if (first.node_ == nullptr) return last;
+    tree_.RemoveRange(first.node_, last.node_);
+    return last;
+  }
+  // удаляет ключи, для которых pred истинен; подряд идущие - как диапазон
+  template <typename Pred>
+  friend size_type erase_if(set &s, Pred pred) {
+    size_type before = s.size();
+    iterator iter = s.begin();
+    while (iter != s.end()) {
+      if (!pred(*iter)) {
+        ++iter;
+        continue;
+      }
+      iterator last = iter;
+      ++last;
+      while (last != s.end() && pred(*last)) ++last;
+      iter = s.erase(iter, last);
+    }
+    return before - s.size();
+  }
+
+  // вынимает ключ вместе с узлом, не освобождая память; для end() или
+  // отсутствующего ключа дескриптор пустой
+  node_type extract(iterator pos) {
+    if (pos.node_ == nullptr) return node_type();
+    return node_type(tree_.Extract(pos.node_));
+  }
+  node_type extract(const key_type &key) {
+    return extract(iterator(tree_.Search(key), tree_.GetHeader()));
+  }
+
+  // вставляет вынутый узел без выделения памяти; ключ можно поменять до
+  // вставки через node.key()
+  insert_return_type insert(node_type &&node) {
+    if (node.empty()) return insert_return_type{end(), false, node_type()};
+    auto r = tree_.Reinsert(node.Get(), true);
+    iterator position(r.first, tree_.GetHeader());
+    if (!r.second) return insert_return_type{position, false, std::move(node)};
+    node.Release();
+    return insert_return_type{position, true, node_type()};
+  }
+
+  tree_type GetTree() { return this->tree_; }
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
 #endif  // CPP2_SRC_S21_SET_H_
\ No newline at end of file
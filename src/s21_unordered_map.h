@@ -0,0 +1,177 @@
+#ifndef CPP2_SRC_S21_UNORDERED_MAP_H_
+#define CPP2_SRC_S21_UNORDERED_MAP_H_
+
+#include <functional>  // для std::hash, std::equal_to
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>  // для std::pair
+
+#include "hash_table.h"
+
+namespace s21 {
+
+/*
+Hash dictionary with the s21::map method names, for exact-match lookups that
+don't need ordering. Open addressing in a SwissTable-style HashTable: one
+control byte per slot, probed eight slots at a time. Lookups, inserts and
+erases are O(1) on average. Iteration order is unspecified, and an insert
+that grows the table invalidates iterators. Values live in a preallocated
+array, so mapped_type must be default-constructible; a failed insert
+leaves the map as it was.
+
+max_load_factor(f) sets how full the table may get before it grows:
+lower values trade memory for shorter probes. The default is 0.875, and
+values are clamped to (0, 0.9375].
+ */
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using table_type = HashTable<key_type, mapped_type, Hash, KeyEqual>;
+  using iterator = HashIterator<key_type, mapped_type, Hash, KeyEqual>;
+  using const_iterator = HashIterator<key_type, mapped_type, Hash, KeyEqual>;
+  using size_type = std::size_t;
+
+  unordered_map() : table_() {}
+
+  unordered_map(std::initializer_list<value_type> const &items)
+      : unordered_map() {
+    table_.Reserve(items.size());
+    for (const_reference item : items) insert(item);
+  }
+
+  unordered_map(const unordered_map &other) : table_(other.table_) {}
+  unordered_map(unordered_map &&other) : table_(std::move(other.table_)) {}
+
+  ~unordered_map() {}
+
+  unordered_map &operator=(unordered_map &&other) {
+    table_ = std::move(other.table_);
+    return *this;
+  }
+
+  // element access
+
+  mapped_type &at(const key_type &key) {
+    size_type i = table_.Find(key);
+    if (i == table_.Capacity()) {
+      throw std::out_of_range("s21::unordered_map::at: out_of_range");
+    }
+    return table_.Value(i);
+  }
+
+  mapped_type &operator[](const key_type &key) {
+    return table_.Value(table_.Insert(key).first);
+  }
+
+  // iterators
+
+  iterator begin() { return iterator(table_.Next(0), &table_); }
+
+  iterator end() { return iterator(table_.Capacity(), &table_); }
+
+  // capacity
+
+  bool empty() { return table_.Size() == 0; }
+
+  size_type size() { return table_.Size(); }
+
+  size_type max_size() { return table_.MaxSize(); }
+
+  // modifiers
+
+  void clear() { table_.Clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    auto r = table_.Insert(value.first);
+    if (r.second) AssignNew(r.first, value.second);
+    return std::make_pair(iterator(r.first, &table_), r.second);
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return insert(value_type(key, obj));
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    auto r = table_.Insert(key);
+    if (r.second) {
+      AssignNew(r.first, obj);
+    } else {
+      table_.Value(r.first) = obj;
+    }
+    return std::make_pair(iterator(r.first, &table_), true);
+  }
+
+  void erase(iterator pos) {
+    if (pos.index_ < table_.Capacity()) table_.EraseAt(pos.index_);
+  }
+
+  // returns the number of erased elements (0 or 1)
+  size_type erase(const key_type &key) { return table_.Remove(key) ? 1 : 0; }
+
+  void swap(unordered_map &other) { table_.Swap(other.table_); }
+
+  // like s21::map::merge: elements of other whose keys are not here move
+  // here, the rest stay in other
+  void merge(unordered_map &other) {
+    if (this == &other) return;
+    table_.Reserve(size() + other.size());
+    for (iterator iter = other.begin(); iter != other.end(); ++iter) {
+      auto r = table_.Insert(iter->first);
+      if (r.second) {
+        AssignNew(r.first, std::move(iter->second));
+        other.table_.EraseAt(iter.index_);
+      }
+    }
+  }
+
+  // lookup
+
+  iterator find(const key_type &key) {
+    return iterator(table_.Find(key), &table_);
+  }
+
+  bool contains(const key_type &key) {
+    return table_.Find(key) != table_.Capacity();
+  }
+
+  // hash policy
+
+  float load_factor() const { return table_.LoadFactor(); }
+
+  float max_load_factor() const { return table_.MaxLoadFactor(); }
+
+  void max_load_factor(float factor) { table_.SetMaxLoadFactor(factor); }
+
+  size_type bucket_count() const { return table_.Capacity(); }
+
+  void rehash(size_type count) { table_.Rehash(count); }
+
+  void reserve(size_type count) { table_.Reserve(count); }
+
+ private:
+  // the table stores values in a default-constructed array, so a new key
+  // gets its value by assignment; if that throws, the key is removed again
+  // and no default-valued entry is left behind
+  template <typename Value>
+  void AssignNew(size_type i, Value &&value) {
+    try {
+      table_.Value(i) = std::forward<Value>(value);
+    } catch (...) {
+      table_.EraseAt(i);
+      throw;
+    }
+  }
+
+  table_type table_;
+};
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_UNORDERED_MAP_H_
@@ -0,0 +1,119 @@
+#ifndef CPP2_SRC_S21_UNORDERED_SET_H_
+#define CPP2_SRC_S21_UNORDERED_SET_H_
+
+#include <functional>  // для std::hash, std::equal_to
+#include <initializer_list>
+#include <utility>  // для std::pair
+
+#include "hash_table.h"
+
+namespace s21 {
+
+/*
+Hash set with the s21::set method names, stored in the same open-addressing
+HashTable as unordered_map but without a value array. Membership tests are
+O(1) on average; iteration order is unspecified and an insert that grows the
+table invalidates iterators.
+ */
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using table_type = HashTable<key_type, void, Hash, KeyEqual>;
+  using iterator = HashIterator<key_type, void, Hash, KeyEqual>;
+  using const_iterator = HashIterator<key_type, void, Hash, KeyEqual>;
+  using size_type = std::size_t;
+
+  unordered_set() : table_() {}
+
+  unordered_set(std::initializer_list<value_type> const &items)
+      : unordered_set() {
+    table_.Reserve(items.size());
+    for (const_reference item : items) insert(item);
+  }
+
+  unordered_set(const unordered_set &other) : table_(other.table_) {}
+  unordered_set(unordered_set &&other) : table_(std::move(other.table_)) {}
+
+  ~unordered_set() {}
+
+  unordered_set &operator=(unordered_set &&other) {
+    table_ = std::move(other.table_);
+    return *this;
+  }
+
+  // iterators
+
+  iterator begin() { return iterator(table_.Next(0), &table_); }
+
+  iterator end() { return iterator(table_.Capacity(), &table_); }
+
+  // capacity
+
+  bool empty() { return table_.Size() == 0; }
+
+  size_type size() { return table_.Size(); }
+
+  size_type max_size() { return table_.MaxSize(); }
+
+  // modifiers
+
+  void clear() { table_.Clear(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    auto r = table_.Insert(value);
+    return std::make_pair(iterator(r.first, &table_), r.second);
+  }
+
+  void erase(iterator pos) {
+    if (pos.index_ < table_.Capacity()) table_.EraseAt(pos.index_);
+  }
+
+  size_type erase(const key_type &key) { return table_.Remove(key) ? 1 : 0; }
+
+  void swap(unordered_set &other) { table_.Swap(other.table_); }
+
+  // like s21::set::merge: keys of other that are not here move here, the
+  // rest stay in other
+  void merge(unordered_set &other) {
+    if (this == &other) return;
+    table_.Reserve(size() + other.size());
+    for (iterator iter = other.begin(); iter != other.end(); ++iter) {
+      if (table_.Insert(*iter).second) other.table_.EraseAt(iter.index_);
+    }
+  }
+
+  // lookup
+
+  iterator find(const key_type &key) {
+    return iterator(table_.Find(key), &table_);
+  }
+
+  bool contains(const key_type &key) {
+    return table_.Find(key) != table_.Capacity();
+  }
+
+  // hash policy
+
+  float load_factor() const { return table_.LoadFactor(); }
+
+  float max_load_factor() const { return table_.MaxLoadFactor(); }
+
+  void max_load_factor(float factor) { table_.SetMaxLoadFactor(factor); }
+
+  size_type bucket_count() const { return table_.Capacity(); }
+
+  void rehash(size_type count) { table_.Rehash(count); }
+
+  void reserve(size_type count) { table_.Reserve(count); }
+
+ private:
+  table_type table_;
+};
+}  // namespace s21
+
+#endif  // CPP2_SRC_S21_UNORDERED_SET_H_
@@ -38,7 +38,7 @@ class Vector {
   Vector(const Vector &v)
       : vSize(v.vSize),
         vCapacity(v.vCapacity),
-        vArr(new value_type[v.vSize]()) {
+        vArr(v.vCapacity ? new value_type[v.vCapacity]() : nullptr) {
     CopyEntryVector(v);
   }
 
@@ -49,7 +49,7 @@ class Vector {
     v.vArr = nullptr;
   }
 
-  ~Vector() { clear(); }
+  ~Vector() { CleanVectorArr(); }
 
   // methods
 
@@ -61,7 +61,7 @@ class Vector {
       CleanVectorArr();
       vSize = v.vSize;
       vCapacity = v.vCapacity;
-      vArr = new value_type[vSize]();
+      vArr = vCapacity ? new value_type[vCapacity]() : nullptr;
       CopyEntryVector(v);
     }
     return *this;
@@ -216,8 +216,10 @@ class Vector {
   changes to capacity is in the specification of vector::reserve, see
    */
   void clear() noexcept {
-    CleanVectorArr();
-    vArr = nullptr;
+    // the buffer is kept, so the old slots are reset like in pop_back
+    for (size_type i = 0; i < vSize; ++i) {
+      vArr[i] = value_type();
+    }
     vSize = 0;
   }
 
@@ -289,9 +291,12 @@ class Vector {
   Calling pop_back on an empty container results in undefined behavior.
   Iterators (including the end() iterator) and references to the last element
   are invalidated.
+  The slot stays inside the allocated array (it is destroyed by delete[] and may
+  be assigned again by push_back), so it is reset to a default value instead of
+  calling the destructor.
    */
   void pop_back() {
-    vArr[vSize - 1].~value_type();
+    vArr[vSize - 1] = value_type();
     --vSize;
   }
 
@@ -1,127 +1,359 @@
 #ifndef CPP2_SRC_TREE_H_
 #define CPP2_SRC_TREE_H_
 
+#include <cstdint>  // для std::uintptr_t
 #include <iostream>
-#include <limits>  // для std::numeric_limits
+#include <iterator>  // для std::bidirectional_iterator_tag
+#include <limits>   // для std::numeric_limits
+#include <tuple>    // для std::forward_as_tuple
+#include <type_traits>
+#include <utility>  // для std::pair, std::piecewise_construct
+
+#include "s21_vector.h"
 
 namespace s21 {
 
 /**
- * Здесь три класса:
+ * Здесь шесть классов:
  * - class Node
- * - class Tree
+ * - struct TreeHeader (корень и крайние узлы дерева)
+ * - class Tree (красно-черное дерево)
  * - class Iterator
+ * - class Range (диапазон [first, last) для обхода в цикле for)
+ * - class NodeHandle (узел, вынутый из дерева)
  */
 
 // ========== КЛАСС УЗЛА ============== //
 
+// Размер поддерева хранится в узле только для дерева с Counted == true
+// (ранг и выборка k-го элемента за O(log n)). В обычном дереве база пустая
+// и узел не становится больше
+template <bool Counted>
+struct NodeCount {};
+
+template <>
+struct NodeCount<true> {
+  size_t count = 1;  // число узлов в поддереве, включая этот
+};
+
+// Что хранит узел. У словаря (map) это пара <const ключ, значение> подряд,
+// как value_type у std::map, у множества (V = void) - только ключ, без
+// лишнего поля под значение. reference - то, что отдает итератор
 template <typename T, typename V>
-class Node {
+struct NodeValue {
+  using type = std::pair<const T, V>;
+  using reference = type&;
+  static const T& Key(const type& value) { return value.first; }
+};
+
+template <typename T>
+struct NodeValue<T, void> {
+  using type = T;
+  using reference = const T&;  // ключ множества менять через итератор нельзя
+  static const T& Key(const T& value) { return value; }
+};
+
+template <typename T, typename V = void, bool Counted = false>
+class Node : public NodeCount<Counted> {
  public:
-  T key;              // значение ключа
-  V val;              // Згачение значения
-  Node<T, V>* left;   // указатель на левый узел
-  Node<T, V>* right;  // указатель на правый узел
-  Node<T, V>* top;    // указатель на родителя
-
-  bool is_min;  // если true то это узел с самым минимальным значением
-  bool is_max;  // если true то это узел с самым максимальным значением
-
-  // КОнструкторы для создания узла со значением ключа
-  Node(const T& key)
-      : key(key),
-        left(nullptr),
-        right(nullptr),
-        top(nullptr),
-        is_min(false),
-        is_max(false) {}
-  Node(T& key)
-      : key(key),
+  using value_type = typename NodeValue<T, V>::type;
+
+  value_type value;            // ключ или пара <ключ, значение>
+  Node<T, V, Counted>* left;   // указатель на левый узел
+  Node<T, V, Counted>* right;  // указатель на правый узел
+
+  // Конструктор передает аргументы прямо в конструктор value:
+  // Node(key) для множества, Node(pair) или Node(piecewise_construct, ...)
+  // для словаря. Новый узел всегда красный
+  template <typename... Args>
+  explicit Node(Args&&... args)
+      : value(std::forward<Args>(args)...),
         left(nullptr),
         right(nullptr),
-        top(nullptr),
-        is_min(false),
-        is_max(false) {}
+        top_(kRed) {}
+
+  const T& GetKey() const { return NodeValue<T, V>::Key(value); }
+
+  // родитель и цвет хранятся в одном слове: узлы выровнены хотя бы по
+  // указателю, поэтому младший бит адреса родителя всегда 0 и под цвет
+  // отдельный bool (с выравниванием - еще 8 байт на узел) не нужен
+  Node<T, V, Counted>* GetTop() const {
+    return reinterpret_cast<Node<T, V, Counted>*>(top_ & ~kRed);
+  }
+  void SetTop(Node<T, V, Counted>* top) {
+    top_ = reinterpret_cast<std::uintptr_t>(top) | (top_ & kRed);
+  }
+  bool IsRed() const { return (top_ & kRed) != 0; }
+  void SetRed(bool red) { top_ = red ? (top_ | kRed) : (top_ & ~kRed); }
+
+ private:
+  static constexpr std::uintptr_t kRed = 1;  // бит цвета в top_
+  std::uintptr_t top_;  // указатель на родителя | красный ли узел
 };  // end class Node
 
-// ========== КЛАСС ПРОСТОГО БИНАРНОГО ДЕРЕВА ============== //
+// ========== ЗАГОЛОВОК ДЕРЕВА ============== //
+
+// Корень и крайние узлы дерева. Заголовок лежит внутри Tree, а итераторы
+// хранят указатель на него: begin() берет leftmost без спуска от корня, а
+// шаг назад из end() (node_ == nullptr) сразу попадает на rightmost
+template <typename T, typename V, bool Counted>
+struct TreeHeader {
+  Node<T, V, Counted>* root = nullptr;       // указатель на корень дерева
+  Node<T, V, Counted>* leftmost = nullptr;   // узел с минимальным ключом
+  Node<T, V, Counted>* rightmost = nullptr;  // узел с максимальным ключом
+};
+
+// ========== КЛАСС КРАСНО-ЧЕРНОГО ДЕРЕВА ============== //
 
 // Здесь объявляем класс и его параметры, функции и т.д.
 // описание самих функций идет ниже класса
-template <typename T, typename V>
+// Дерево балансируется как красно-черное: корень черный, у красного узла нет
+// красных потомков, на любом пути от узла вниз одинаковое число черных узлов.
+// Поэтому высота не больше 2*log2(n + 1), и поиск, вставка, удаление,
+// LowerBound и UpperBound работают за O(log n) при любом порядке вставки
+template <typename T, typename V = void, bool Counted = false>
 class Tree {
  public:
   // КОНСТРУКТОРЫ И ДЕСТРУКТОРЫ
   Tree();  // конструктор по умолчанию - пустое дерево
   Tree(const Tree& copy);  // конструктор копирования
+  Tree(Tree&& other);      // конструктор перемещения
   ~Tree();  // деструктор (удаляет узлы дерева и выставляет
             // указатель на корень - null)
 
   // Перезагрузка оператора присваивания для перемещающегося объекта
-  Tree<T, V>& operator=(Tree&& other);
+  Tree<T, V, Counted>& operator=(Tree&& other);
 
   // ОСНОВНЫЕ ПУБЛИЧНЫЕ МЕТОДЫ ДЛЯ РАБОТЫ С ДЕРЕВОМ
-  Node<T, V>* Insert(T key);  // вставка узла в соответсвующее место по ключу
+  // вставка узла в соответсвующее место по ключу
+  Node<T, V, Counted>* Insert(T key);
+
+  // вставка ключа, если такого еще нет в дереве
+  // возвращает пару: <узел с этим ключом, была ли вставка>
+  // args - аргументы конструктора значения V, узел создается только если
+  // ключа еще нет
+  template <typename... Args>
+  std::pair<Node<T, V, Counted>*, bool> InsertUnique(const T& key,
+                                                     Args&&... args);
+  // то же с подсказкой: hint - узел, перед которым, скорее всего, встанет
+  // key (nullptr - позиция end()), или узел прямо перед key. Если подсказка
+  // верна, спуска от корня нет и вставка стоит в среднем O(1) (плюс
+  // пересчет счетчиков в Tree<T, V, true>), иначе обычный спуск
+  template <typename... Args>
+  std::pair<Node<T, V, Counted>*, bool> InsertUniqueHint(
+      Node<T, V, Counted>* hint, const T& key, Args&&... args);
+  // вставка ключа даже если такой уже есть (для multiset),
+  // равный ключ встает после уже имеющихся, возвращает новый узел
+  Node<T, V, Counted>* InsertMulti(const T& key);
 
   // полностью очищает поддерево от переданново узла
-  void ClearTree(Node<T, V>* node);
+  void ClearTree(Node<T, V, Counted>* node);
+
+  // заменяет содержимое n значениями, начиная с first. Значения должны идти
+  // по возрастанию ключа без повторов: дерево строится снизу вверх за O(n),
+  // без сравнений и поворотов. *first - аргумент конструктора узла (ключ
+  // для множества, пара для словаря)
+  template <typename InputIt>
+  void AssignSorted(InputIt first, size_t n);
+
+  // переносит узлы other в это дерево, не перевыделяя их. При unique узлы с
+  // ключами, которые здесь уже есть, остаются в other (как у std::map::merge)
+  void Merge(Tree& other, bool unique);
+
+  // объединение, пересечение и разность деревьев с уникальными ключами.
+  // Результат заменяет содержимое этого дерева (this может совпадать с a или
+  // b); если ключ есть в обоих деревьях, значение берется из a
+  void AssignUnion(const Tree& a, const Tree& b);
+  void AssignIntersection(const Tree& a, const Tree& b);
+  void AssignDifference(const Tree& a, const Tree& b);
+
+  // разрез по ключу: узлы с ключами не меньше key переносятся в greater
+  // (его прежнее содержимое удаляется), здесь остаются меньшие. Дерево
+  // перестраивается за O(log n), узлы не перевыделяются. Размер половин в
+  // Tree<T, V, true> берется из счетчиков, иначе считается проходом по
+  // меньшей половине
+  void Split(const T& key, Tree& greater);
+  // приписывает узлы other к этому дереву за O(log n), other становится
+  // пустым. Ключи other должны быть все больше ключей этого дерева или все
+  // меньше (без unique допускаются равные на стыке); если диапазоны
+  // пересекаются, ничего не меняется и возвращается false
+  bool Join(Tree& other, bool unique);
 
   // полное копирование дерева передать указатель на корень копируемого дерева
-  // !!! не копирует остальные приватные параметры (T min, T max, Size)
-  Node<T, V>* CopyTree(Node<T, V>* node);
+  // !!! не копирует остальные приватные параметры (leftmost, rightmost, size)
+  Node<T, V, Counted>* CopyTree(Node<T, V, Counted>* node);
   // метод для поиска узла по переданному ключу
-  Node<T, V>* Search(T key);
+  Node<T, V, Counted>* Search(T key) const;
+
+  // поиск первого узла с ключом не меньше (LowerBound)
+  // и строго больше (UpperBound) переданного, nullptr если такого нет
+  Node<T, V, Counted>* LowerBound(const T& key);
+  Node<T, V, Counted>* UpperBound(const T& key);
 
   // методы для удаления узла дерева по переданному ключу
   void Remove(T key);
+  // удаление конкретного узла (нужно когда ключи повторяются)
+  void RemoveNode(Node<T, V, Counted>* node);
+  // удаление узлов [first, last) по порядку (last == nullptr - до конца),
+  // O(k + log n) для k узлов. Возвращает last
+  Node<T, V, Counted>* RemoveRange(Node<T, V, Counted>* first,
+                                   Node<T, V, Counted>* last);
+  // выводит узел из дерева и отдает его вызывающему, не удаляя
+  Node<T, V, Counted>* Extract(Node<T, V, Counted>* node);
+  // подвешивает узел, вынутый Extract (из этого или другого дерева), без
+  // выделения памяти. При unique и уже имеющемся ключе узел не вставляется:
+  // возвращается пара <узел с этим ключом, false>
+  std::pair<Node<T, V, Counted>*, bool> Reinsert(Node<T, V, Counted>* node,
+                                                 bool unique);
   // смена содержимого контейнера на содержимое другого
-  void Swap(Tree<T, V>& other);
+  void Swap(Tree<T, V, Counted>& other);
   size_t MaxSize();  // возвращает максимальный размер контейнера (весьма
                      // неоднозначная функция)
 
+  // порядковая статистика, только для Tree<T, V, true>, O(log n):
+  // узел с номером k по возрастанию (с нуля), nullptr если k >= size
+  Node<T, V, Counted>* Nth(size_t k);
+  // число ключей строго меньше key
+  size_t Rank(const T& key);
+  // номер узла по возрастанию, для nullptr (позиция end) - size
+  size_t Index(Node<T, V, Counted>* node);
+
  private:
   // ПАРАМЕТРЫ КЛАССА ДЕРЕВА делаем приватными для безопасности
-  Node<T, V>* root;  // указатель на корень дерева
-  T min;  // для хранения максимального значения ключа дерева
-  T max;  // для хранения минимального значения
+  TreeHeader<T, V, Counted> header;  // корень и крайние узлы
   size_t size;  // размер дерева
 
  private:  // приватные вспомогательные методы, которыу учавствуют только в этом
            // классе
+  // место для нового узла: родитель, сторона и станет ли узел крайним
+  struct Slot {
+    Node<T, V, Counted>* parent = nullptr;
+    bool to_left = false;
+    bool first = true;  // сворачивали только налево
+    bool last = true;   // сворачивали только направо
+  };
+  // спуск для вставки key; при unique возвращает узел с равным ключом
+  // (тогда slot не заполнен), иначе nullptr
+  Node<T, V, Counted>* FindSlot(const T& key, bool unique, Slot& slot);
+  // место для key рядом с hint: false, если подсказка не подошла. При
+  // unique и равном ключе рядом с hint он записывается в equal
+  bool FindHintSlot(Node<T, V, Counted>* hint, const T& key, bool unique,
+                    Slot& slot, Node<T, V, Counted>*& equal);
+  // создает узел со значением из key и args и подвешивает его на slot
+  template <typename... Args>
+  Node<T, V, Counted>* CreateNode(const Slot& slot, const T& key,
+                                  Args&&... args);
+  // подвешивает готовый узел на место slot и восстанавливает баланс
+  void LinkNode(Node<T, V, Counted>* node, const Slot& slot);
+  // выводит узел из дерева, не удаляя его
+  void UnlinkNode(Node<T, V, Counted>* node);
+  // строит дерево из узлов run (по возрастанию), копируя их значения
+  void AssignNodes(const Vector<Node<T, V, Counted>*>& run);
+  // поиск каждого из small ключей в дереве из large выгоднее линейного
+  // прохода по обоим: small * log2(large) < small + large
+  static bool SearchIsCheaper(size_t small, size_t large);
+
   // вспомогательный метод для вставки узла
-  Node<T, V>* Insert(Node<T, V>* node, T key, Node<T, V>* parent);
+  template <typename... Args>
+  std::pair<Node<T, V, Counted>*, bool> InsertNode(const T& key, bool unique,
+                                                   Args&&... args);
   // вспомогательный метод для поиска узла по ключу
-  Node<T, V>* Search(T key, Node<T, V>* node);
+  Node<T, V, Counted>* Search(T key, Node<T, V, Counted>* node) const;
+  // строит поддерево из n следующих значений first, корень на глубине depth
+  template <typename InputIt>
+  static Node<T, V, Counted>* BuildSorted(InputIt& first, size_t n,
+                                          size_t depth, size_t red_depth);
 
   // вспомогательные методы для удаления узла
-  Node<T, V>* FindMin(Node<T, V>* node);
-  Node<T, V>* RemoveMin(Node<T, V>* node);
-  Node<T, V>* Remove(Node<T, V>* node, T key);
+  // освобождает поддерево node, возвращает число удаленных узлов
+  static size_t DeleteSubtree(Node<T, V, Counted>* node);
+  static Node<T, V, Counted>* CloneNode(const Node<T, V, Counted>* node);
+  static Node<T, V, Counted>* FindMin(Node<T, V, Counted>* node);
+  static Node<T, V, Counted>* FindMax(Node<T, V, Counted>* node);
+  // ставит поддерево child на место узла node у его родителя
+  void Replace(Node<T, V, Counted>* node, Node<T, V, Counted>* child);
+
+  // вспомогательные методы для балансировки
+  void RotateLeft(Node<T, V, Counted>* node);
+  void RotateRight(Node<T, V, Counted>* node);
+  // возвращает true, если в конце пришлось перекрасить корень в черный:
+  // черная высота дерева выросла на 1
+  bool InsertFixup(Node<T, V, Counted>* node);
+  void RemoveFixup(Node<T, V, Counted>* node, Node<T, V, Counted>* parent);
+
+  // разрез и соединение работают с отдельными поддеревьями, у которых
+  // корень черный и известна черная высота (число черных узлов на пути от
+  // корня вниз, включая корень; 0 для nullptr)
+  static size_t BlackHeight(Node<T, V, Counted>* node);
+  // соединяет left < mid < right в одно дерево, возвращает корень, в height -
+  // его черная высота. header.root используется как рабочий корень
+  Node<T, V, Counted>* JoinNodes(Node<T, V, Counted>* left, size_t left_height,
+                                 Node<T, V, Counted>* mid,
+                                 Node<T, V, Counted>* right,
+                                 size_t right_height, size_t& height);
+  // разрезает поддерево node на ключи меньше key и не меньше key
+  void SplitNodes(Node<T, V, Counted>* node, size_t node_height, const T& key,
+                  Node<T, V, Counted>*& less, size_t& less_height,
+                  Node<T, V, Counted>*& greater, size_t& greater_height);
+  // Split с уже известным размером меньшей половины
+  void SplitTree(const T& key, Tree& greater, size_t less_size);
+  // приписывает справа непустое дерево other с большими ключами, other
+  // становится пустым. Размер этого дерева выставляет вызывающий
+  void Append(Tree& other);
+  // с какого числа узлов RemoveRange режет дерево, а не удаляет по одному
+  static constexpr size_t kRemoveRangeMin = 8;
+
+  // следующий по возрастанию узел, nullptr после последнего
+  static Node<T, V, Counted>* Next(Node<T, V, Counted>* node);
+  // предыдущий узел, nullptr перед первым
+  static Node<T, V, Counted>* Prev(Node<T, V, Counted>* node);
+
+  // размер поддерева (0 для nullptr) и его пересчет по детям
+  static size_t Count(Node<T, V, Counted>* node);
+  static void Recount(Node<T, V, Counted>* node);
 
  public:
   // геттеры и сеттеры для работы с приватными параметрами
   size_t GetSize() { return this->size; }
-  Node<T, V>* GetRoot() { return this->root; }
-  void SetRoot(Node<T, V>* root) { this->root = root; }
-  T GetMax() { return this->max; }
-  T GetMin() { return this->min; }
+  Node<T, V, Counted>* GetRoot() { return header.root; }
+  Node<T, V, Counted>* GetRoot() const { return header.root; }
+  void SetRoot(Node<T, V, Counted>* root) { header.root = root; }
+  T GetMax() { return GetLast() != nullptr ? GetLast()->GetKey() : T(); }
+  T GetMin() { return GetFirst() != nullptr ? GetFirst()->GetKey() : T(); }
+  // крайние узлы за O(1), nullptr у пустого дерева
+  Node<T, V, Counted>* GetFirst() const { return header.leftmost; }
+  Node<T, V, Counted>* GetLast() const { return header.rightmost; }
+  // заголовок, на который ссылаются итераторы этого дерева
+  const TreeHeader<T, V, Counted>* GetHeader() const { return &header; }
 };  // end class Tree
 /**
  * КОНСТРУКТОР ПО УМОЛЧАНИЮ
  * создает пустое дерево, где указатель на корень - null,
  */
-template <typename T, typename V>
-Tree<T, V>::Tree() : root(nullptr), min(), max(), size(0) {}
+template <typename T, typename V, bool Counted>
+Tree<T, V, Counted>::Tree() : header(), size(0) {}
 
 /**
  * КОНСТРУКТОР КОПИРОВАНИЯ ДЕРЕВА
  */
-template <typename T, typename V>
-Tree<T, V>::Tree(const Tree& copy) : root(CopyTree(copy.root)) {
+template <typename T, typename V, bool Counted>
+Tree<T, V, Counted>::Tree(const Tree& copy) : header() {
+  header.root = CopyTree(copy.header.root);
   this->size = copy.size;
 
-  this->max = copy.max;
-  this->min = copy.min;
+  if (header.root != nullptr) {
+    header.leftmost = FindMin(header.root);
+    header.rightmost = FindMax(header.root);
+  }
+}
+
+/**
+ * КОНСТРУКТОР ПЕРЕМЕЩЕНИЯ
+ * забирает узлы other, other остается пустым деревом
+ */
+template <typename T, typename V, bool Counted>
+Tree<T, V, Counted>::Tree(Tree&& other) : Tree() {
+  Swap(other);
 }
 
 /**
@@ -129,194 +361,647 @@ Tree<T, V>::Tree(const Tree& copy) : root(CopyTree(copy.root)) {
  * Удаляются узлы дерева и значение указателя на корень дерева (root)
  * выставляется в null
  */
-template <typename T, typename V>
-Tree<T, V>::~Tree() {
-  ClearTree(root);
+template <typename T, typename V, bool Counted>
+Tree<T, V, Counted>::~Tree() {
+  ClearTree(header.root);
   // root = nullptr;
 }
 
 // оператор присваивания переносом
-template <typename T, typename V>
-Tree<T, V>& Tree<T, V>::operator=(Tree&& other) {
-  if (this != other) {
-    ClearTree(root);
-    root = exchange(other.root, nullptr);
+template <typename T, typename V, bool Counted>
+Tree<T, V, Counted>& Tree<T, V, Counted>::operator=(Tree&& other) {
+  if (this != &other) {
+    ClearTree(header.root);
+    Swap(other);
   }
   return *this;
 }
 
 /**
- * Два метода для вставки узла в дерево
+ * Методы для вставки узла в дерево
+ * Insert оставлен для совместимости: вставляет уникальный ключ и возвращает
+ * корень дерева
  */
-template <typename T, typename V>
-Node<T, V>* Tree<T, V>::Insert(T key) {
-  root = Insert(root, key, nullptr);
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::Insert(T key) {
+  InsertNode(key, true);
+  return header.root;
+}
 
-  if (key < this->min || this->size == 0) {
-    this->min = key;
-  }
-  if (key > this->max || this->size == 0) {
-    this->max = key;
+template <typename T, typename V, bool Counted>
+template <typename... Args>
+std::pair<Node<T, V, Counted>*, bool> Tree<T, V, Counted>::InsertUnique(
+    const T& key, Args&&... args) {
+  return InsertNode(key, true, std::forward<Args>(args)...);
+}
+
+template <typename T, typename V, bool Counted>
+template <typename... Args>
+std::pair<Node<T, V, Counted>*, bool> Tree<T, V, Counted>::InsertUniqueHint(
+    Node<T, V, Counted>* hint, const T& key, Args&&... args) {
+  Slot slot;
+  Node<T, V, Counted>* equal = nullptr;
+  if (!FindHintSlot(hint, key, true, slot, equal)) {
+    return InsertNode(key, true, std::forward<Args>(args)...);
   }
-  this->size++;
-  return root;
+  if (equal != nullptr) return std::make_pair(equal, false);
+  return std::make_pair(CreateNode(slot, key, std::forward<Args>(args)...),
+                        true);
 }
 
-template <typename T, typename V>
-Node<T, V>* Tree<T, V>::Insert(Node<T, V>* node, T key, Node<T, V>* parent) {
-  // если дерево пустое, то создаем узел
-  if (node == nullptr) {
-    node = new Node<T, V>(key);
-    node->top = parent;
-    // следующие три if для того что бы вписать в занчение узла
-    // краевой он или нет, для дальнейшего итеррирования без сеги
-    if (this->size < 1) {
-      node->is_max = true;
-      node->is_min = true;
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::InsertMulti(const T& key) {
+  return InsertNode(key, false).first;
+}
+
+/**
+ * Спускаемся от корня без рекурсии: меньшие ключи налево, остальные направо.
+ * При unique == true равный ключ не вставляется и размер не меняется.
+ * По пути запоминаем, сворачивали ли мы только налево (новый узел будет
+ * минимальным) или только направо (новый узел будет максимальным), чтобы
+ * обновить leftmost / rightmost без отдельного спуска
+ */
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::FindSlot(const T& key, bool unique,
+                                                   Slot& slot) {
+  Node<T, V, Counted>* node = header.root;
+  while (node != nullptr) {
+    slot.parent = node;
+    slot.to_left = key < node->GetKey();
+    if (slot.to_left) {
+      node = node->left;
+      slot.last = false;
+    } else if (unique && !(node->GetKey() < key)) {
+      return node;
+    } else {
+      node = node->right;
+      slot.first = false;
     }
-    if (this->size >= 1 && node->key < this->min) {
-      node->is_min = true;
-      node->top->is_min = false;
+  }
+  return nullptr;
+}
+
+template <typename T, typename V, bool Counted>
+template <typename... Args>
+std::pair<Node<T, V, Counted>*, bool> Tree<T, V, Counted>::InsertNode(
+    const T& key, bool unique, Args&&... args) {
+  Slot slot;
+  Node<T, V, Counted>* node = FindSlot(key, unique, slot);
+  if (node != nullptr) return std::make_pair(node, false);
+  return std::make_pair(CreateNode(slot, key, std::forward<Args>(args)...),
+                        true);
+}
+
+template <typename T, typename V, bool Counted>
+template <typename... Args>
+Node<T, V, Counted>* Tree<T, V, Counted>::CreateNode(const Slot& slot,
+                                                     const T& key,
+                                                     Args&&... args) {
+  Node<T, V, Counted>* node = nullptr;
+  if constexpr (std::is_void_v<V>) {
+    node = new Node<T, V, Counted>(key);
+  } else {
+    // пара собирается прямо в узле, V - из args (без args - V())
+    node = new Node<T, V, Counted>(
+        std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  LinkNode(node, slot);
+  return node;
+}
+
+/**
+ * Подсказка проверяется по соседям: key должен встать между prev и next,
+ * где next - hint (или следующий за hint, если key не меньше hint), а prev
+ * - предыдущий перед next. У соседних по порядку узлов свободна либо левая
+ * ссылка next, либо правая ссылка prev (prev - максимум левого поддерева
+ * next или next - минимум правого поддерева prev), туда и встает новый
+ * узел. Соседи крайних узлов берутся из заголовка без подъема по дереву,
+ * поэтому вставка в конец по end() или по предыдущему результату - O(1)
+ * до балансировки
+ */
+template <typename T, typename V, bool Counted>
+bool Tree<T, V, Counted>::FindHintSlot(Node<T, V, Counted>* hint,
+                                       const T& key, bool unique, Slot& slot,
+                                       Node<T, V, Counted>*& equal) {
+  if (header.root == nullptr) return false;
+  Node<T, V, Counted>* next = hint;
+  if (next != nullptr && !(key < next->GetKey())) {
+    if (unique && !(next->GetKey() < key)) {
+      equal = next;
+      return true;
     }
-    if (this->size >= 1 && node->key > this->max) {
-      node->is_max = true;
-      node->top->is_max = false;
+    next = next == header.rightmost ? nullptr : Next(next);
+  }
+  Node<T, V, Counted>* prev = nullptr;
+  if (next == nullptr) {
+    prev = header.rightmost;
+  } else if (next != header.leftmost) {
+    prev = Prev(next);
+  }
+  if (prev != nullptr && !(prev->GetKey() < key)) {
+    if (!unique || key < prev->GetKey()) return false;
+    equal = prev;
+    return true;
+  }
+  if (next != nullptr && !(key < next->GetKey())) {
+    if (!unique || next->GetKey() < key) return false;
+    equal = next;
+    return true;
+  }
+  if (next != nullptr && next->left == nullptr) {
+    slot.parent = next;
+    slot.to_left = true;
+    slot.first = prev == nullptr;
+    slot.last = false;
+  } else {
+    slot.parent = prev;
+    slot.to_left = false;
+    slot.first = false;
+    slot.last = next == nullptr;
+  }
+  return true;
+}
+
+// узел мог прийти из другого дерева, поэтому связи и цвет задаются заново
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::LinkNode(Node<T, V, Counted>* node,
+                                   const Slot& slot) {
+  node->left = nullptr;
+  node->right = nullptr;
+  node->SetTop(slot.parent);
+  node->SetRed(true);
+  if (slot.parent == nullptr) {
+    header.root = node;
+  } else if (slot.to_left) {
+    slot.parent->left = node;
+  } else {
+    slot.parent->right = node;
+  }
+
+  if (slot.first) header.leftmost = node;
+  if (slot.last) header.rightmost = node;
+  this->size++;
+  if constexpr (Counted) {
+    node->count = 1;
+    for (Node<T, V, Counted>* up = slot.parent; up != nullptr;
+         up = up->GetTop()) {
+      up->count++;
     }
+  }
+  InsertFixup(node);
+}
 
-  } else {  // если дерево не пустое то рекурсивно идем по нему в нужное место
-    if (key < node->key) {
-      node->left = Insert(node->left, key, node);
-    } else if (key > node->key) {
-      node->right = Insert(node->right, key, node);
+/**
+ * Восстановление свойств красно-черного дерева после вставки красного узла.
+ * Пока родитель красный:
+ * - если "дядя" тоже красный, перекрашиваем и поднимаемся к деду
+ * - иначе одним или двумя поворотами делаем родителя вершиной поддерева
+ */
+template <typename T, typename V, bool Counted>
+bool Tree<T, V, Counted>::InsertFixup(Node<T, V, Counted>* node) {
+  while (node->GetTop() != nullptr && node->GetTop()->IsRed()) {
+    Node<T, V, Counted>* parent = node->GetTop();
+    // красный узел не корень, дед есть
+    Node<T, V, Counted>* grand = parent->GetTop();
+    if (parent == grand->left) {
+      Node<T, V, Counted>* uncle = grand->right;
+      if (uncle != nullptr && uncle->IsRed()) {
+        parent->SetRed(false);
+        uncle->SetRed(false);
+        grand->SetRed(true);
+        node = grand;
+      } else {
+        if (node == parent->right) {
+          RotateLeft(parent);
+          node = parent;
+          parent = node->GetTop();
+        }
+        parent->SetRed(false);
+        grand->SetRed(true);
+        RotateRight(grand);
+      }
+    } else {
+      Node<T, V, Counted>* uncle = grand->left;
+      if (uncle != nullptr && uncle->IsRed()) {
+        parent->SetRed(false);
+        uncle->SetRed(false);
+        grand->SetRed(true);
+        node = grand;
+      } else {
+        if (node == parent->left) {
+          RotateRight(parent);
+          node = parent;
+          parent = node->GetTop();
+        }
+        parent->SetRed(false);
+        grand->SetRed(true);
+        RotateLeft(grand);
+      }
     }
   }
+  bool grew = header.root->IsRed();
+  header.root->SetRed(false);
+  return grew;
+}
 
-  return node;
+// левый поворот вокруг node: правый потомок встает на место node
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::RotateLeft(Node<T, V, Counted>* node) {
+  Node<T, V, Counted>* child = node->right;
+  node->right = child->left;
+  if (child->left != nullptr) child->left->SetTop(node);
+  Replace(node, child);
+  child->left = node;
+  node->SetTop(child);
+  if constexpr (Counted) {
+    child->count = node->count;
+    Recount(node);
+  }
+}
+
+// правый поворот вокруг node: левый потомок встает на место node
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::RotateRight(Node<T, V, Counted>* node) {
+  Node<T, V, Counted>* child = node->left;
+  node->left = child->right;
+  if (child->right != nullptr) child->right->SetTop(node);
+  Replace(node, child);
+  child->right = node;
+  node->SetTop(child);
+  if constexpr (Counted) {
+    child->count = node->count;
+    Recount(node);
+  }
 }
 
 /**
  * полностью очищает дерево
  * принимает указатель на корневой узел
  */
-template <typename T, typename V>
-void Tree<T, V>::ClearTree(Node<T, V>* node) {
-  if (node != nullptr) {
-    ClearTree(node->left);
-    ClearTree(node->right);
-    delete node;
-  }
-  root = nullptr;
-  max = {};
-  min = {};
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::ClearTree(Node<T, V, Counted>* node) {
+  DeleteSubtree(node);
+  header.root = nullptr;
+  header.leftmost = nullptr;
+  header.rightmost = nullptr;
   size = 0;
 }
 
+template <typename T, typename V, bool Counted>
+size_t Tree<T, V, Counted>::DeleteSubtree(Node<T, V, Counted>* node) {
+  if (node == nullptr) return 0;
+  size_t count = DeleteSubtree(node->left) + DeleteSubtree(node->right) + 1;
+  delete node;
+  return count;
+}
+
 /**
  * метод копирования всего дерева
  * принимает указатель на корневой узел копируемого дерева
  * !!! перед копированием нужно инициализировать пустое дерево
  * возвращаемое значение - указатель на корневой узел нового дерева
+ *
+ * Обход в прямом порядке без рекурсии: спускаемся налево, копируя узлы, а
+ * правых детей, до которых еще не дошли, откладываем в стек вместе с уже
+ * скопированным родителем. Каждый узел исходного дерева читается один раз,
+ * узлы копии создаются в порядке спуска по дереву, а их родители - узлы
+ * копии. Отложенных правых детей не больше высоты дерева: 2 * log2(n + 1)
+ * меньше 128 для любого n, которое помещается в size_t
  */
-template <typename T, typename V>
-Node<T, V>* Tree<T, V>::CopyTree(Node<T, V>* node) {
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::CopyTree(Node<T, V, Counted>* node) {
   if (node == nullptr) return nullptr;
-  Node<T, V>* newNode = new Node<T, V>(node->key);
-  newNode->left = CopyTree(node->left);
-  newNode->right = CopyTree(node->right);
-  newNode->top = node->top;
-  // this->size++;
-  newNode->is_max = node->is_max;
-  newNode->is_min = node->is_min;
+  struct Pending {
+    Node<T, V, Counted>* src;     // правый ребенок в исходном дереве
+    Node<T, V, Counted>* parent;  // копия его родителя
+  };
+  Pending stack[2 * std::numeric_limits<size_t>::digits];
+  size_t depth = 0;
+  Node<T, V, Counted>* root = CloneNode(node);
+  Node<T, V, Counted>* src = node;
+  Node<T, V, Counted>* dst = root;
+  try {
+    while (true) {
+      if (src->right != nullptr) stack[depth++] = Pending{src->right, dst};
+      if (src->left != nullptr) {
+        dst->left = CloneNode(src->left);
+        dst->left->SetTop(dst);
+        src = src->left;
+        dst = dst->left;
+      } else if (depth > 0) {
+        Pending next = stack[--depth];
+        next.parent->right = CloneNode(next.src);
+        next.parent->right->SetTop(next.parent);
+        src = next.src;
+        dst = next.parent->right;
+      } else {
+        break;
+      }
+    }
+  } catch (...) {
+    DeleteSubtree(root);  // копия значения бросила: уже созданное удаляем
+    throw;
+  }
+  return root;
+}
 
-  return newNode;
+// отдельный узел с тем же значением, цветом и счетчиком, без связей
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::CloneNode(
+    const Node<T, V, Counted>* node) {
+  Node<T, V, Counted>* clone = new Node<T, V, Counted>(node->value);
+  clone->SetRed(node->IsRed());
+  if constexpr (Counted) clone->count = node->count;
+  return clone;
+}
+
+/**
+ * Построение из отсортированных значений: средний элемент становится
+ * корнем, половины слева и справа - поддеревьями (узлы создаются в порядке
+ * обхода, поэтому хватает одного прохода по first). Размеры соседних
+ * поддеревьев отличаются не больше чем на 1, так что уровни 0..red_depth-1
+ * заполнены целиком, а последний неполный уровень - на глубине red_depth.
+ * Его узлы красные, остальные черные: на любом пути вниз ровно red_depth
+ * черных узлов, и это корректное красно-черное дерево
+ */
+template <typename T, typename V, bool Counted>
+template <typename InputIt>
+void Tree<T, V, Counted>::AssignSorted(InputIt first, size_t n) {
+  ClearTree(header.root);
+  size_t red_depth = 0;  // число полных уровней: 2^red_depth - 1 <= n
+  while ((size_t{2} << red_depth) - 1 <= n) ++red_depth;
+  header.root = BuildSorted(first, n, 0, red_depth);
+  if (header.root != nullptr) {
+    header.leftmost = FindMin(header.root);
+    header.rightmost = FindMax(header.root);
+  }
+  size = n;
+}
+
+template <typename T, typename V, bool Counted>
+template <typename InputIt>
+Node<T, V, Counted>* Tree<T, V, Counted>::BuildSorted(InputIt& first,
+                                                      size_t n, size_t depth,
+                                                      size_t red_depth) {
+  if (n == 0) return nullptr;
+  Node<T, V, Counted>* left = BuildSorted(first, n / 2, depth + 1, red_depth);
+  Node<T, V, Counted>* node = new Node<T, V, Counted>(*first);
+  ++first;
+  node->left = left;
+  node->right = BuildSorted(first, n - n / 2 - 1, depth + 1, red_depth);
+  if (node->left != nullptr) node->left->SetTop(node);
+  if (node->right != nullptr) node->right->SetTop(node);
+  node->SetRed(depth == red_depth);
+  if constexpr (Counted) node->count = n;
+  return node;
 }
 
 /**
  * Два метода для поиска значения ключа в дереве
  * возвращаемое значение на указатель узла этого ключа
  */
-template <typename T, typename V>
-Node<T, V>* Tree<T, V>::Search(T key) {
-  return Search(key, root);
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::Search(T key) const {
+  return Search(key, header.root);
 }
 
-template <typename T, typename V>
-Node<T, V>* Tree<T, V>::Search(T key, Node<T, V>* node) {
-  if (node == nullptr || node->key == key) {
-    return node;
-  }
-  if (key < node->key) {
-    return Search(key, node->left);
-  } else {
-    return Search(key, node->right);
+// спуск циклом, без рекурсии; ключи сравниваются только через <
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::Search(
+    T key, Node<T, V, Counted>* node) const {
+  while (node != nullptr) {
+    if (key < node->GetKey()) {
+      node = node->left;
+    } else if (node->GetKey() < key) {
+      node = node->right;
+    } else {
+      return node;
+    }
   }
+  return nullptr;
 }
 
-// Методы для удаления узла дерева
-template <typename T, typename V>
-void Tree<T, V>::Remove(T key) {
-  Node<T, V>* n = Search(key);
-  if (key == this->min) {
-    // std::cout << "Проверка Размер: " << this->min << std::endl;
-    if (size > 1) {
-      if (n->top != nullptr) this->min = n->top->key;
-      if (n->top == nullptr) this->min = n->right->key;
+// один спуск от корня, запоминаем последний узел, где свернули налево
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::LowerBound(const T& key) {
+  Node<T, V, Counted>* result = nullptr;
+  Node<T, V, Counted>* node = header.root;
+  while (node != nullptr) {
+    if (node->GetKey() < key) {
+      node = node->right;
+    } else {
+      result = node;
+      node = node->left;
     }
   }
-  if (key == this->max) {
-    if (size > 1) {
-      if (n->top != nullptr) this->max = n->top->key;
-      if (n->top == nullptr) this->max = n->left->key;
+  return result;
+}
+
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::UpperBound(const T& key) {
+  Node<T, V, Counted>* result = nullptr;
+  Node<T, V, Counted>* node = header.root;
+  while (node != nullptr) {
+    if (key < node->GetKey()) {
+      result = node;
+      node = node->left;
+    } else {
+      node = node->right;
     }
   }
-  root = Remove(root, key);
+  return result;
 }
 
-template <typename T, typename V>
-Node<T, V>* Tree<T, V>::FindMin(Node<T, V>* node) {
-  if (!node->left) return node;
-  return FindMin(node->left);
+// Методы для удаления узла дерева
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::Remove(T key) {
+  Node<T, V, Counted>* node = Search(key);
+  if (node != nullptr) RemoveNode(node);
 }
-template <typename T, typename V>
-Node<T, V>* Tree<T, V>::RemoveMin(Node<T, V>* node) {
-  if (!node->left) return node->right;
-  node->left = RemoveMin(node->left);
+
+/**
+ * Удаление конкретного узла:
+ * - если у узла не больше одного потомка, то потомок встает на его место
+ * - иначе на его место встает следующий по порядку узел (минимальный в
+ *   правом поддереве) и забирает цвет удаляемого
+ * Если со своего места ушел черный узел, баланс восстанавливает RemoveFixup.
+ * Указатели на родителей (top), leftmost и rightmost остаются верными
+ */
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::RemoveNode(Node<T, V, Counted>* node) {
+  UnlinkNode(node);
+  delete node;
+}
+
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::Extract(Node<T, V, Counted>* node) {
+  UnlinkNode(node);
   return node;
 }
-template <typename T, typename V>
-Node<T, V>* Tree<T, V>::Remove(Node<T, V>* node, T key) {
-  if (!node) return nullptr;
-  if (key < node->key) {
-    node->left = Remove(node->left, key);
-  } else if (key > node->key) {
-    node->right = Remove(node->right, key);
+
+template <typename T, typename V, bool Counted>
+std::pair<Node<T, V, Counted>*, bool> Tree<T, V, Counted>::Reinsert(
+    Node<T, V, Counted>* node, bool unique) {
+  Slot slot;
+  Node<T, V, Counted>* found = FindSlot(node->GetKey(), unique, slot);
+  if (found != nullptr) return std::make_pair(found, false);
+  LinkNode(node, slot);
+  return std::make_pair(node, true);
+}
+
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::UnlinkNode(Node<T, V, Counted>* node) {
+  // если удаляется крайний узел, крайним станет его сосед по порядку: у
+  // минимального нет левого потомка, поэтому это минимум правого поддерева
+  // или родитель (для максимального - зеркально)
+  if (node == header.leftmost) {
+    header.leftmost =
+        node->right != nullptr ? FindMin(node->right) : node->GetTop();
+  }
+  if (node == header.rightmost) {
+    header.rightmost =
+        node->left != nullptr ? FindMax(node->left) : node->GetTop();
+  }
+  bool removed_red = node->IsRed();
+  // узел, вставший на освободившееся место, и его родитель (child может быть
+  // nullptr)
+  Node<T, V, Counted>* child = nullptr;
+  Node<T, V, Counted>* parent = nullptr;
+  if (node->left == nullptr) {
+    child = node->right;
+    parent = node->GetTop();
+    Replace(node, node->right);
+  } else if (node->right == nullptr) {
+    child = node->left;
+    parent = node->GetTop();
+    Replace(node, node->left);
   } else {
-    Node<T, V>* left = node->left;
-    Node<T, V>* right = node->right;
-    delete node;
-    if (!right) return left;
-    if (!left) return right;
-    // std::cout << "Размерasd: " << left->key << std::endl;
-    Node<T, V>* min = FindMin(right);
-    min->right = RemoveMin(right);
-    min->left = left;
-    min->left->top = right;
-    this->size--;
-    // min->top = node->top;
-
-    return min;
+    Node<T, V, Counted>* next = FindMin(node->right);
+    removed_red = next->IsRed();
+    child = next->right;
+    if (next->GetTop() != node) {
+      parent = next->GetTop();
+      Replace(next, next->right);
+      next->right = node->right;
+      next->right->SetTop(next);
+    } else {
+      parent = next;
+    }
+    Replace(node, next);
+    next->left = node->left;
+    next->left->SetTop(next);
+    next->SetRed(node->IsRed());
+  }
+  if constexpr (Counted) {
+    // ниже parent ничего не менялось, выше - пересчитываем по пути к корню
+    for (Node<T, V, Counted>* up = parent; up != nullptr; up = up->GetTop()) {
+      Recount(up);
+    }
   }
+  if (!removed_red) RemoveFixup(child, parent);
   this->size--;
+}
+
+/**
+ * Восстановление свойств после удаления черного узла: у поддерева node не
+ * хватает одного черного узла. Пока node черный (или nullptr) и не корень,
+ * смотрим на "брата":
+ * - красный брат поворотом превращается в черного
+ * - у черного брата с черными детьми перекрашиваем брата и поднимаемся выше
+ * - иначе один или два поворота у родителя добавляют черный узел слева/справа
+ */
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::RemoveFixup(Node<T, V, Counted>* node,
+                                      Node<T, V, Counted>* parent) {
+  while (node != header.root && (node == nullptr || !node->IsRed())) {
+    if (node == parent->left) {
+      Node<T, V, Counted>* brother = parent->right;
+      if (brother->IsRed()) {
+        brother->SetRed(false);
+        parent->SetRed(true);
+        RotateLeft(parent);
+        brother = parent->right;
+      }
+      if ((brother->left == nullptr || !brother->left->IsRed()) &&
+          (brother->right == nullptr || !brother->right->IsRed())) {
+        brother->SetRed(true);
+        node = parent;
+        parent = node->GetTop();
+      } else {
+        if (brother->right == nullptr || !brother->right->IsRed()) {
+          brother->left->SetRed(false);
+          brother->SetRed(true);
+          RotateRight(brother);
+          brother = parent->right;
+        }
+        brother->SetRed(parent->IsRed());
+        parent->SetRed(false);
+        brother->right->SetRed(false);
+        RotateLeft(parent);
+        node = header.root;
+      }
+    } else {
+      Node<T, V, Counted>* brother = parent->left;
+      if (brother->IsRed()) {
+        brother->SetRed(false);
+        parent->SetRed(true);
+        RotateRight(parent);
+        brother = parent->left;
+      }
+      if ((brother->left == nullptr || !brother->left->IsRed()) &&
+          (brother->right == nullptr || !brother->right->IsRed())) {
+        brother->SetRed(true);
+        node = parent;
+        parent = node->GetTop();
+      } else {
+        if (brother->left == nullptr || !brother->left->IsRed()) {
+          brother->right->SetRed(false);
+          brother->SetRed(true);
+          RotateLeft(brother);
+          brother = parent->left;
+        }
+        brother->SetRed(parent->IsRed());
+        parent->SetRed(false);
+        brother->left->SetRed(false);
+        RotateRight(parent);
+        node = header.root;
+      }
+    }
+  }
+  if (node != nullptr) node->SetRed(false);
+}
+
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::Replace(Node<T, V, Counted>* node,
+                                  Node<T, V, Counted>* child) {
+  if (node->GetTop() == nullptr) {
+    header.root = child;
+  } else if (node->GetTop()->left == node) {
+    node->GetTop()->left = child;
+  } else {
+    node->GetTop()->right = child;
+  }
+  if (child != nullptr) child->SetTop(node->GetTop());
+}
+
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::FindMin(Node<T, V, Counted>* node) {
+  while (node->left != nullptr) node = node->left;
+  return node;
+}
+
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::FindMax(Node<T, V, Counted>* node) {
+  while (node->right != nullptr) node = node->right;
   return node;
 }
 
 // смена содержимого контейнера на содержимое другого
-template <typename T, typename V>
-void Tree<T, V>::Swap(Tree<T, V>& other) {
-  std::swap(root, other.root);
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::Swap(Tree<T, V, Counted>& other) {
+  std::swap(header, other.header);
   std::swap(size, other.size);
-  std::swap(min, other.min);
-  std::swap(max, other.max);
 }
 
 /* Расчет максимального размера контейнера
@@ -335,47 +1020,528 @@ void Tree<T, V>::Swap(Tree<T, V>& other) {
  * Функция выводит число но это число больше оригинала, может что то нужно
  * исправить...
  */
-template <typename T, typename V>
-size_t Tree<T, V>::MaxSize() {
+template <typename T, typename V, bool Counted>
+size_t Tree<T, V, Counted>::MaxSize() {
   size_t max_size =
-      std::numeric_limits<size_t>::max() / 2 / sizeof(Node<T, V>*);
+      std::numeric_limits<size_t>::max() / 2 / sizeof(Node<T, V, Counted>*);
   return max_size;
 }
 
+template <typename T, typename V, bool Counted>
+size_t Tree<T, V, Counted>::Count(Node<T, V, Counted>* node) {
+  static_assert(Counted, "subtree sizes are stored only in Tree<T, V, true>");
+  return node == nullptr ? 0 : node->count;
+}
+
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::Recount(Node<T, V, Counted>* node) {
+  node->count = 1 + Count(node->left) + Count(node->right);
+}
+
+// спуск от корня: слева Count(left) узлов, сам узел, дальше правое поддерево
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::Nth(size_t k) {
+  Node<T, V, Counted>* node = header.root;
+  while (node != nullptr) {
+    size_t left = Count(node->left);
+    if (k < left) {
+      node = node->left;
+    } else if (k == left) {
+      return node;
+    } else {
+      k -= left + 1;
+      node = node->right;
+    }
+  }
+  return nullptr;
+}
+
+// спуск как в LowerBound, сворачивая направо прибавляем левое поддерево и узел
+template <typename T, typename V, bool Counted>
+size_t Tree<T, V, Counted>::Rank(const T& key) {
+  size_t rank = 0;
+  Node<T, V, Counted>* node = header.root;
+  while (node != nullptr) {
+    if (node->GetKey() < key) {
+      rank += Count(node->left) + 1;
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return rank;
+}
+
+// подъем к корню: за каждый родитель, справа от которого мы лежим,
+// прибавляем его левое поддерево и его самого
+template <typename T, typename V, bool Counted>
+size_t Tree<T, V, Counted>::Index(Node<T, V, Counted>* node) {
+  if (node == nullptr) return size;
+  size_t index = Count(node->left);
+  for (; node->GetTop() != nullptr; node = node->GetTop()) {
+    if (node == node->GetTop()->right) index += Count(node->GetTop()->left) + 1;
+  }
+  return index;
+}
+
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::Next(Node<T, V, Counted>* node) {
+  if (node->right != nullptr) return FindMin(node->right);
+  Node<T, V, Counted>* parent = node->GetTop();
+  while (parent != nullptr && node == parent->right) {
+    node = parent;
+    parent = parent->GetTop();
+  }
+  return parent;
+}
+
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::Prev(Node<T, V, Counted>* node) {
+  if (node->left != nullptr) return FindMax(node->left);
+  Node<T, V, Counted>* parent = node->GetTop();
+  while (parent != nullptr && node == parent->left) {
+    node = parent;
+    parent = parent->GetTop();
+  }
+  return parent;
+}
+
+/**
+ * Слияние переносом узлов: каждый узел other отцепляется от other и
+ * подвешивается сюда, память не перевыделяется и значения не копируются,
+ * O(m log(n + m)). Следующий узел other запоминаем заранее: при отцеплении
+ * узлы только меняют места, поэтому он остается следующим.
+ * В пустое дерево все узлы переходят обменом за O(1)
+ */
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::Merge(Tree& other, bool unique) {
+  if (this == &other) return;
+  if (size == 0) {
+    Swap(other);
+    return;
+  }
+  Node<T, V, Counted>* node = other.header.leftmost;
+  while (node != nullptr) {
+    Node<T, V, Counted>* next = Next(node);
+    Slot slot;
+    if (FindSlot(node->GetKey(), unique, slot) == nullptr) {
+      other.UnlinkNode(node);
+      LinkNode(node, slot);
+    }
+    node = next;
+  }
+}
+
+/**
+ * Разрез и соединение (join-based подход к красно-черным деревьям).
+ * JoinNodes подвешивает mid на месте первого черного узла с черной высотой
+ * низкого дерева на краю высокого: справа у левого дерева, слева у правого.
+ * Узел mid красный, его дети - черные поддеревья равной высоты, поэтому
+ * нарушиться может только правило "красный под красным", и его исправляет
+ * обычный InsertFixup. Спуск и подъем идут только по краю на глубину
+ * разницы высот: O(|left_height - right_height| + 1).
+ * SplitNodes спускается к key; по пути каждый узел со своим поддеревьем с
+ * другой стороны от key присоединяется к соответствующей половине. Высоты
+ * соседних соединений идут по возрастанию, разницы складываются в высоту
+ * дерева, поэтому весь разрез - O(log n)
+ */
+template <typename T, typename V, bool Counted>
+size_t Tree<T, V, Counted>::BlackHeight(Node<T, V, Counted>* node) {
+  size_t height = 0;
+  for (; node != nullptr; node = node->left) {
+    if (!node->IsRed()) ++height;
+  }
+  return height;
+}
+
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::JoinNodes(
+    Node<T, V, Counted>* left, size_t left_height, Node<T, V, Counted>* mid,
+    Node<T, V, Counted>* right, size_t right_height, size_t& height) {
+  // mid встает на правый край left, если left не ниже, иначе на левый right
+  bool to_right = left_height >= right_height;
+  Node<T, V, Counted>* parent = nullptr;
+  Node<T, V, Counted>* node = to_right ? left : right;
+  size_t node_height = to_right ? left_height : right_height;
+  size_t target = to_right ? right_height : left_height;
+  while (node_height > target || (node != nullptr && node->IsRed())) {
+    if (!node->IsRed()) --node_height;
+    parent = node;
+    node = to_right ? node->right : node->left;
+  }
+  mid->left = to_right ? node : left;
+  mid->right = to_right ? right : node;
+  if (mid->left != nullptr) mid->left->SetTop(mid);
+  if (mid->right != nullptr) mid->right->SetTop(mid);
+  mid->SetTop(parent);
+  if constexpr (Counted) Recount(mid);
+  if (parent == nullptr) {  // высоты равны: mid - черный корень
+    mid->SetRed(false);
+    height = target + 1;
+    return mid;
+  }
+  mid->SetRed(true);
+  if (to_right) {
+    parent->right = mid;
+  } else {
+    parent->left = mid;
+  }
+  if constexpr (Counted) {
+    for (Node<T, V, Counted>* up = parent; up != nullptr; up = up->GetTop()) {
+      Recount(up);
+    }
+  }
+  header.root = to_right ? left : right;
+  height = to_right ? left_height : right_height;
+  if (InsertFixup(mid)) ++height;
+  return header.root;
+}
+
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::SplitNodes(Node<T, V, Counted>* node,
+                                     size_t node_height, const T& key,
+                                     Node<T, V, Counted>*& less,
+                                     size_t& less_height,
+                                     Node<T, V, Counted>*& greater,
+                                     size_t& greater_height) {
+  if (node == nullptr) {
+    less = greater = nullptr;
+    less_height = greater_height = 0;
+    return;
+  }
+  // дети становятся отдельными деревьями: красный корень перекрашивается в
+  // черный, и черная высота такого дерева растет на 1
+  Node<T, V, Counted>* child[2] = {node->left, node->right};
+  size_t child_height[2] = {node_height - 1, node_height - 1};
+  for (int i = 0; i < 2; ++i) {
+    if (child[i] == nullptr) continue;
+    child[i]->SetTop(nullptr);
+    if (child[i]->IsRed()) {
+      child[i]->SetRed(false);
+      ++child_height[i];
+    }
+  }
+  if (node->GetKey() < key) {
+    Node<T, V, Counted>* rest = nullptr;
+    size_t rest_height = 0;
+    SplitNodes(child[1], child_height[1], key, rest, rest_height, greater,
+               greater_height);
+    less = JoinNodes(child[0], child_height[0], node, rest, rest_height,
+                     less_height);
+  } else {
+    Node<T, V, Counted>* rest = nullptr;
+    size_t rest_height = 0;
+    SplitNodes(child[0], child_height[0], key, less, less_height, rest,
+               rest_height);
+    greater = JoinNodes(rest, rest_height, node, child[1], child_height[1],
+                        greater_height);
+  }
+}
+
+// размер половин считаем до разреза: в дереве со счетчиками это Rank, иначе
+// идем одновременно от обоих краев к key, пока не кончится меньшая половина
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::Split(const T& key, Tree& greater) {
+  if (this == &greater) return;
+  greater.ClearTree(greater.header.root);
+  if (header.root == nullptr) return;
+  size_t less_size = 0;
+  if constexpr (Counted) {
+    less_size = Rank(key);
+  } else {
+    Node<T, V, Counted>* bound = LowerBound(key);
+    Node<T, V, Counted>* lo = header.leftmost;
+    Node<T, V, Counted>* hi = header.rightmost;
+    size_t greater_size = 0;
+    while (true) {
+      if (lo == bound) break;
+      ++less_size;
+      lo = Next(lo);
+      if (hi == nullptr || hi->GetKey() < key) {
+        less_size = size - greater_size;
+        break;
+      }
+      ++greater_size;
+      hi = Prev(hi);
+    }
+  }
+  SplitTree(key, greater, less_size);
+}
+
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::SplitTree(const T& key, Tree& greater,
+                                    size_t less_size) {
+  Node<T, V, Counted>* first = header.leftmost;
+  Node<T, V, Counted>* last = header.rightmost;
+  Node<T, V, Counted>* less = nullptr;
+  Node<T, V, Counted>* more = nullptr;
+  size_t less_height = 0;
+  size_t more_height = 0;
+  SplitNodes(header.root, BlackHeight(header.root), key, less, less_height,
+             more, more_height);
+
+  greater.header.root = more;
+  greater.header.leftmost = more != nullptr ? FindMin(more) : nullptr;
+  greater.header.rightmost = more != nullptr ? last : nullptr;
+  greater.size = size - less_size;
+  header.root = less;
+  header.leftmost = less != nullptr ? first : nullptr;
+  header.rightmost = less != nullptr ? FindMax(less) : nullptr;
+  size = less_size;
+}
+
+template <typename T, typename V, bool Counted>
+bool Tree<T, V, Counted>::Join(Tree& other, bool unique) {
+  if (this == &other || other.size == 0) return true;
+  if (size == 0) {
+    Swap(other);
+    return true;
+  }
+  auto before = [unique](const T& a, const T& b) {
+    return unique ? a < b : !(b < a);
+  };
+  if (!before(header.rightmost->GetKey(), other.header.leftmost->GetKey())) {
+    if (!before(other.header.rightmost->GetKey(), header.leftmost->GetKey())) {
+      return false;
+    }
+    Swap(other);  // other целиком левее: меняем деревья местами
+  }
+  size_t total = size + other.size;
+  Append(other);
+  size = total;
+  return true;
+}
+
+// стыкующий узел - минимум правого дерева: он вынимается обычным удалением
+// за O(log n) и становится mid для JoinNodes
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::Append(Tree& other) {
+  Node<T, V, Counted>* mid = other.header.leftmost;
+  other.UnlinkNode(mid);
+  Node<T, V, Counted>* right = other.header.root;
+  Node<T, V, Counted>* last = right != nullptr ? other.header.rightmost : mid;
+  size_t height = 0;
+  header.root = JoinNodes(header.root, BlackHeight(header.root), mid, right,
+                          BlackHeight(right), height);
+  header.rightmost = last;
+  other.header = TreeHeader<T, V, Counted>();
+  other.size = 0;
+}
+
+/**
+ * Удаление [first, last). Короткий диапазон (меньше kRemoveRangeMin узлов),
+ * а также диапазон, на границе которого стоят равные ключи (в multiset),
+ * удаляются по одному: каждое удаление без поиска, балансировка в среднем
+ * O(1). Иначе диапазон вырезается двумя разрезами по ключам first и last,
+ * его поддерево освобождается целиком (заодно считаются узлы), а края
+ * соединяются обратно: O(k + log n)
+ */
+template <typename T, typename V, bool Counted>
+Node<T, V, Counted>* Tree<T, V, Counted>::RemoveRange(
+    Node<T, V, Counted>* first, Node<T, V, Counted>* last) {
+  if (first == last) return last;
+  if (first == header.leftmost && last == nullptr) {
+    ClearTree(header.root);
+    return nullptr;
+  }
+  // короткий диапазон определяем, пройдя не больше kRemoveRangeMin узлов
+  Node<T, V, Counted>* node = first;
+  for (size_t i = 0; i < kRemoveRangeMin && node != last; ++i) {
+    node = Next(node);
+  }
+  Node<T, V, Counted>* before = Prev(first);
+  Node<T, V, Counted>* tail = last != nullptr ? Prev(last) : header.rightmost;
+  bool by_key = (before == nullptr || before->GetKey() < first->GetKey()) &&
+                (last == nullptr || tail->GetKey() < last->GetKey());
+  if (node == last || !by_key) {
+    while (first != last) {
+      Node<T, V, Counted>* next = Next(first);
+      RemoveNode(first);
+      first = next;
+    }
+    return last;
+  }
+  // размер частей без счетчиков неизвестен, поэтому промежуточные размеры
+  // условные, а итоговый - исходный минус число освобожденных узлов
+  size_t old_size = size;
+  Tree middle;
+  SplitTree(first->GetKey(), middle, 0);
+  Tree rest;
+  if (last != nullptr) middle.SplitTree(last->GetKey(), rest, 0);
+  size_t count = DeleteSubtree(middle.header.root);
+  middle.header = TreeHeader<T, V, Counted>();
+  middle.size = 0;
+  if (rest.header.root != nullptr) {
+    if (header.root == nullptr) {
+      Swap(rest);
+    } else {
+      Append(rest);
+    }
+  }
+  size = old_size - count;
+  return last;
+}
+
+template <typename T, typename V, bool Counted>
+bool Tree<T, V, Counted>::SearchIsCheaper(size_t small, size_t large) {
+  size_t log2 = 1;
+  while ((size_t{1} << log2) < large) ++log2;
+  return small * log2 < small + large;
+}
+
+// результат собирается в отдельном дереве, а потом обменивается: узлы run
+// могут принадлежать этому же дереву
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::AssignNodes(
+    const Vector<Node<T, V, Counted>*>& run) {
+  struct Values {  // значения узлов run по порядку, для AssignSorted
+    Node<T, V, Counted>* const* node;
+    const typename Node<T, V, Counted>::value_type& operator*() const {
+      return (*node)->value;
+    }
+    Values& operator++() {
+      ++node;
+      return *this;
+    }
+  };
+  Tree<T, V, Counted> result;
+  result.AssignSorted(Values{run.data()}, run.size());
+  Swap(result);
+}
+
+/**
+ * Операции над множествами - один совместный проход по двум
+ * отсортированным последовательностям узлов, O(n + m), и построение
+ * результата за O(size). Объединение всегда такое: в его результате не
+ * меньше max(n, m) узлов, быстрее не бывает. В пересечении (меньшее
+ * дерево любое) и разности (меньшее - a) вместо прохода по большому дереву
+ * каждый из m ключей меньшего ищется в большом, O(m log n), когда
+ * SearchIsCheaper. Разность с маленьким b так не ускоряется: в результате
+ * почти все n узлов a
+ */
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::AssignUnion(const Tree& a, const Tree& b) {
+  Vector<Node<T, V, Counted>*> run;
+  run.reserve(a.size + b.size);
+  Node<T, V, Counted>* x = a.header.leftmost;
+  Node<T, V, Counted>* y = b.header.leftmost;
+  while (x != nullptr && y != nullptr) {
+    if (y->GetKey() < x->GetKey()) {
+      run.push_back(y);
+      y = Next(y);
+    } else {
+      if (!(x->GetKey() < y->GetKey())) y = Next(y);  // равные ключи
+      run.push_back(x);
+      x = Next(x);
+    }
+  }
+  for (; x != nullptr; x = Next(x)) run.push_back(x);
+  for (; y != nullptr; y = Next(y)) run.push_back(y);
+  AssignNodes(run);
+}
+
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::AssignIntersection(const Tree& a, const Tree& b) {
+  Vector<Node<T, V, Counted>*> run;
+  Node<T, V, Counted>* x = a.header.leftmost;
+  Node<T, V, Counted>* y = b.header.leftmost;
+  if (SearchIsCheaper(a.size, b.size)) {
+    for (; x != nullptr; x = Next(x)) {
+      if (b.Search(x->GetKey()) != nullptr) run.push_back(x);
+    }
+  } else if (SearchIsCheaper(b.size, a.size)) {
+    for (; y != nullptr; y = Next(y)) {
+      Node<T, V, Counted>* found = a.Search(y->GetKey());
+      if (found != nullptr) run.push_back(found);
+    }
+  } else {
+    while (x != nullptr && y != nullptr) {
+      if (x->GetKey() < y->GetKey()) {
+        x = Next(x);
+      } else if (y->GetKey() < x->GetKey()) {
+        y = Next(y);
+      } else {
+        run.push_back(x);
+        x = Next(x);
+        y = Next(y);
+      }
+    }
+  }
+  AssignNodes(run);
+}
+
+template <typename T, typename V, bool Counted>
+void Tree<T, V, Counted>::AssignDifference(const Tree& a, const Tree& b) {
+  Vector<Node<T, V, Counted>*> run;
+  Node<T, V, Counted>* x = a.header.leftmost;
+  Node<T, V, Counted>* y = b.header.leftmost;
+  if (SearchIsCheaper(a.size, b.size)) {
+    for (; x != nullptr; x = Next(x)) {
+      if (b.Search(x->GetKey()) == nullptr) run.push_back(x);
+    }
+  } else {
+    while (x != nullptr) {
+      if (y == nullptr || x->GetKey() < y->GetKey()) {
+        run.push_back(x);
+        x = Next(x);
+      } else if (y->GetKey() < x->GetKey()) {
+        y = Next(y);
+      } else {
+        x = Next(x);
+        y = Next(y);
+      }
+    }
+  }
+  AssignNodes(run);
+}
+
 // ========== КЛАСС ИТЕРАТОР ========== //
-template <typename T, typename V>
+template <typename T, typename V = void, bool Counted = false>
 class Iterator {
  public:
+  // типы для std::iterator_traits (нужны, например, std::reverse_iterator)
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename NodeValue<T, V>::type;
+  using difference_type = std::ptrdiff_t;
+  using reference = typename NodeValue<T, V>::reference;
+  using pointer = std::remove_reference_t<reference>*;
+
   // содержит два параметра:
-  Node<T, V>* node_;  // указатель на текущий узел дерева
-  Node<T, V>* root_;  // указатель на корневой узел дерева
+  Node<T, V, Counted>* node_;  // текущий узел, nullptr - позиция end()
+  const TreeHeader<T, V, Counted>* header_;  // заголовок дерева
 
   // единственный конструктор,
-  // принимает указатель на узел (node) и указатель на корень (root)
+  // принимает указатель на узел (node) и заголовок дерева (header)
   // и передает их в параметры класса
-  Iterator(Node<T, V>* node, Node<T, V>* root) : node_(node), root_(root) {}
+  Iterator(Node<T, V, Counted>* node, const TreeHeader<T, V, Counted>* header)
+      : node_(node), header_(header) {}
 
   // перезагружаем операторы:
-  // получение указателя на значение ключа, на узел которого указывает итератор
-  T& operator*() const { return node_->key; }
+  // доступ к содержимому узла: ключ для множества,
+  // пара <const ключ, значение> для словаря
+
+  reference operator*() const { return node_->value; }
+  pointer operator->() const { return &node_->value; }
 
   // Перезагрузка операторов инкремента и декремента:
   // Сделаем постфиксную и префиксную перезагрузку:
   // https://learn.microsoft.com/ru-ru/cpp/cpp/increment-and-decrement-operator-overloading-cpp?view=msvc-170
 
   // перезагрузка префиксного оператора инкремента
+  // после максимального элемента итератор переходит в позицию end()
+  // (node_ == nullptr), дальше end() не двигается
   Iterator& operator++() {
-    if (node_ != nullptr && node_->is_max != true) {
+    if (node_ != nullptr) {
       if (node_->right != nullptr) {
         node_ = node_->right;
         while (node_->left != nullptr) {
           node_ = node_->left;
         }
       } else {
-        Node<T, V>* parent = node_->top;
+        Node<T, V, Counted>* parent = node_->GetTop();
         while (parent != nullptr && node_ == parent->right) {
           node_ = parent;
-          parent = parent->top;
+          parent = parent->GetTop();
         }
         node_ = parent;
       }
@@ -393,23 +1559,27 @@ class Iterator {
   }
 
   // перезагрузка префиксного оператора декремента
+  // из end() за O(1) переходим на максимальный элемент из заголовка
   Iterator& operator--() {
-    if (node_ != nullptr && node_->is_min != true) {
-      if (node_->left != nullptr) {
-        node_ = node_->left;
-        while (node_->right != nullptr) {
-          node_ = node_->right;
-        }
-      } else {
-        Node<T, V>* parent = node_->top;
-        while (parent != nullptr && node_ == parent->left) {
-          node_ = parent;
-          parent = parent->top;
-        }
-        node_ = parent;
-      }
+    if (node_ == nullptr) {
+      if (header_ != nullptr) node_ = header_->rightmost;
       return *this;
     }
+    if (node_->left != nullptr) {
+      node_ = node_->left;
+      while (node_->right != nullptr) {
+        node_ = node_->right;
+      }
+    } else {
+      // у минимального узла предшественника нет - остаемся на нем
+      Node<T, V, Counted>* node = node_;
+      Node<T, V, Counted>* parent = node->GetTop();
+      while (parent != nullptr && node == parent->left) {
+        node = parent;
+        parent = parent->GetTop();
+      }
+      if (parent != nullptr) node_ = parent;
+    }
     return *this;
   }
 
@@ -428,6 +1598,75 @@ class Iterator {
   bool operator!=(const Iterator& other) const { return node_ != other.node_; }
 };  // end class ITERATOR
 
+// ========== КЛАСС ДИАПАЗОНА ========== //
+// Пара итераторов [first, last), которую можно обойти в цикле
+// for (auto& item : map.range(lo, hi))
+template <typename T, typename V = void, bool Counted = false>
+class Range {
+ public:
+  Range(Iterator<T, V, Counted> first, Iterator<T, V, Counted> last)
+      : first_(first), last_(last) {}
+
+  Iterator<T, V, Counted> begin() const { return first_; }
+  Iterator<T, V, Counted> end() const { return last_; }
+  bool empty() const { return first_ == last_; }
+
+ private:
+  Iterator<T, V, Counted> first_;
+  Iterator<T, V, Counted> last_;
+};  // end class Range
+
+// ========== ДЕСКРИПТОР УЗЛА ========== //
+// Владеет узлом, вынутым из дерева (extract), пока его не вставят в это или
+// другое дерево того же типа (insert). Узел не перевыделяется и значение не
+// копируется; если дескриптор так и не вставили, узел удаляется вместе с ним
+template <typename T, typename V = void, bool Counted = false>
+class NodeHandle {
+ public:
+  NodeHandle() : node_(nullptr) {}
+  explicit NodeHandle(Node<T, V, Counted>* node) : node_(node) {}
+  NodeHandle(NodeHandle&& other) : node_(other.node_) {
+    other.node_ = nullptr;
+  }
+  NodeHandle(const NodeHandle&) = delete;
+  ~NodeHandle() { delete node_; }
+
+  NodeHandle& operator=(NodeHandle&& other) {
+    if (this != &other) {
+      delete node_;
+      node_ = other.node_;
+      other.node_ = nullptr;
+    }
+    return *this;
+  }
+  NodeHandle& operator=(const NodeHandle&) = delete;
+
+  bool empty() const { return node_ == nullptr; }
+  explicit operator bool() const { return node_ != nullptr; }
+
+  // ключ, пока узел вне дерева, можно менять: так запись переезжает на
+  // другой ключ без выделения памяти. В словаре ключ лежит в паре как
+  // const, снимаем его так же, как это делают node handle у std::map
+  T& key() const { return const_cast<T&>(node_->GetKey()); }
+
+  // значение словаря
+  template <typename U = V, typename = std::enable_if_t<!std::is_void_v<U>>>
+  U& mapped() const {
+    return node_->value.second;
+  }
+
+  // отдает узел дереву, дескриптор становится пустым
+  Node<T, V, Counted>* Release() {
+    Node<T, V, Counted>* node = node_;
+    node_ = nullptr;
+    return node;
+  }
+  Node<T, V, Counted>* Get() const { return node_; }
+
+ private:
+  Node<T, V, Counted>* node_;
+};  // end class NodeHandle
+
 };  // end namespace s21
 
 #endif  // CPP2_SRC_TREE_H_
\ No newline at end of file